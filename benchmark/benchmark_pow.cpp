@@ -1,12 +1,38 @@
 #include <benchmark/benchmark.h>
+#include <algorithm>
+#include <bit>
 #include <cmath>
+#include <complex>
 #include <cstdint>
 #include <vector>
 #include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include "../src/pow_impl.hpp"
+#include "../src/pow_simd.hpp"
+#include "../src/pow_dispatch.hpp"
+#include "../src/pow_cache.hpp"
+#include "../src/pow_table.hpp"
+#include "../src/pow_parallel.hpp"
+#include "../src/pow_dd.hpp"
+#include "../src/pow_poly.hpp"
 #include "../src/error_util.hpp"
+#include "datasets.hpp"
+
+#if POWERIX_HAS_EIGEN
+#include "../src/pow_eigen.hpp"
+#include <Eigen/Eigenvalues>
+#include <Eigen/Geometry>
+#if __has_include(<unsupported/Eigen/MatrixFunctions>)
+#include <unsupported/Eigen/MatrixFunctions>
+#define POWERIX_HAS_EIGEN_MATRIX_POWER 1
+#endif
+#endif
 
 // Base datasets - only integer and double
 static const std::vector<int32_t> kIntBases{2, 3, 4, 5};
@@ -52,9 +78,24 @@ const auto& get_exps() {
     return exps;
 }
 
+// Accuracy contracts, in ULP of the result type: the integer-exponent ladders
+// are held to pow_ladder_ulp_bound, libm pow to kLibmPowUlpBound
+inline double ladder_ulp_bound(double, double exp) {
+    return powerix::pow_ladder_ulp_bound(exp);
+}
+
+inline double libm_ulp_bound(double, double) {
+    return powerix::kLibmPowUlpBound;
+}
+
+inline double dd_ulp_bound(double, double exp) {
+    return powerix::pow_hierarchical_dd_ulp_bound(exp);
+}
+
 // Helper function to compute error for a specific benchmark
-template<typename Func, typename BaseType, typename ExpType>
-powerix::Error calculate_error_for_benchmark(Func&& func, const std::vector<BaseType>& bases, const std::vector<ExpType>& exps) {
+template<typename Func, typename BaseType, typename ExpType, typename Bound>
+powerix::Error calculate_error_for_benchmark(Func&& func, const std::vector<BaseType>& bases, const std::vector<ExpType>& exps,
+                                             Bound&& ulp_bound, powerix::UlpContract& contract) {
     double max_abs_err = 0.0;
     double max_rel_err = 0.0;
     
@@ -62,26 +103,30 @@ powerix::Error calculate_error_for_benchmark(Func&& func, const std::vector<Base
         for (auto exp : exps) {
             double d_base = static_cast<double>(base);
             double d_exp = static_cast<double>(exp);
-            double reference = std::pow(d_base, d_exp);
-            double test_value = static_cast<double>(func(base, exp));
+            long double reference = powerix::reference_pow(d_base, d_exp);
             
-            auto error = powerix::compute_error(reference, test_value);
+            auto error = powerix::compute_error(reference, func(base, exp));
             max_abs_err = std::max(max_abs_err, error.abs_err);
             max_rel_err = std::max(max_rel_err, error.rel_err);
+            contract.add(d_base, d_exp, error.ulp_err, ulp_bound(d_base, d_exp));
         }
     }
     
-    return {max_abs_err, max_rel_err};
+    return {max_abs_err, max_rel_err, contract.max_ulp};
 }
 
-#define ADD_METRICS_AND_NS_PER_POW(state, func, bases, exps) \
+// Reports the errors and fails the benchmark when the kernel breaks its contract
+#define ADD_METRICS_AND_NS_PER_POW(state, func, bases, exps, ulp_bound) \
     long num_ops = bases.size() * exps.size(); \
-    auto error = calculate_error_for_benchmark(func, bases, exps); \
+    powerix::UlpContract contract; \
+    auto error = calculate_error_for_benchmark(func, bases, exps, ulp_bound, contract); \
     state.counters["MaxRelErr"] = error.rel_err; \
+    state.counters["MaxUlp"] = error.ulp_err; \
+    if (contract.violated) state.SkipWithError(contract.message().c_str()); \
     state.SetItemsProcessed(num_ops);
 
 // Generic benchmark template
-template <auto PowFunc, typename BaseType, typename ExpType>
+template <auto PowFunc, typename BaseType, typename ExpType, auto UlpBound = ladder_ulp_bound>
 void BM_PowGeneric_T(benchmark::State& state) {
     auto func = [](BaseType a, ExpType b) {
         return PowFunc(a, b); // Aucune conversion explicite
@@ -92,7 +137,7 @@ void BM_PowGeneric_T(benchmark::State& state) {
     for (auto _ : state) {
         run_dataset(func, bases, exps);
     }
-    ADD_METRICS_AND_NS_PER_POW(state, func, bases, exps);
+    ADD_METRICS_AND_NS_PER_POW(state, func, bases, exps, UlpBound);
 }
 
 // Specializations for hierarchical power due to its branching logic
@@ -155,21 +200,857 @@ inline auto pow_c_raw_wrapper(BaseType a, ExpType b) {
     return powerix::pow_c_raw(a, b);
 }
 
+// Checked pow: 0 stands in for an overflow so the result can be summed
+template<typename BaseType, typename ExpType>
+inline BaseType pow_checked_wrapper(BaseType a, ExpType b) {
+    return powerix::pow_checked(a, b).value_or(0);
+}
+
+template<typename BaseType, typename ExpType>
+inline BaseType pow_saturating_wrapper(BaseType a, ExpType b) {
+    return powerix::pow_saturating(a, b);
+}
+
+// Double-double ladder rounded once to double
+template<typename BaseType, typename ExpType>
+inline double hierarchical_dd_wrapper(BaseType a, ExpType b) {
+    return powerix::pow_hierarchical_dd(a, b);
+}
+
+// Batch datasets: cycle the scalar datasets over arrays of the requested length
+template <typename T>
+std::vector<T> make_batch_data(const std::vector<T>& pattern, std::size_t n) {
+    std::vector<T> data(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        data[i] = pattern[i % pattern.size()];
+    }
+    return data;
+}
+
+// Errors of a batch output on its first elements; every batch kernel here is
+// held to the ladder contract (std::pow's 1 ULP fits inside it for exp >= 2,
+// and exp 0 and 1 are exact)
+template <typename BaseType, typename ExpType, typename OutType>
+powerix::Error calculate_error_for_batch(const std::vector<BaseType>& bases, const std::vector<ExpType>& exps, const std::vector<OutType>& out,
+                                         powerix::UlpContract& contract) {
+    double max_abs_err = 0.0;
+    double max_rel_err = 0.0;
+    const std::size_t n = std::min<std::size_t>(out.size(), 1024);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const double base = static_cast<double>(bases[i]);
+        const double exp = static_cast<double>(exps[i % exps.size()]);
+        auto error = powerix::compute_error(powerix::reference_pow(base, exp), out[i]);
+        max_abs_err = std::max(max_abs_err, error.abs_err);
+        max_rel_err = std::max(max_rel_err, error.rel_err);
+        contract.add(base, exp, error.ulp_err, powerix::pow_ladder_ulp_bound(exp));
+    }
+
+    return {max_abs_err, max_rel_err, contract.max_ulp};
+}
+
+#define ADD_BATCH_METRICS(state, bases, exps, out) \
+    powerix::UlpContract contract; \
+    auto error = calculate_error_for_batch(bases, exps, out, contract); \
+    state.counters["MaxRelErr"] = error.rel_err; \
+    state.counters["MaxUlp"] = error.ulp_err; \
+    if (contract.violated) state.SkipWithError(contract.message().c_str());
+
+// Batch benchmark with one exponent per element; state.range(0) is the array length
+template <auto BatchFunc, typename BaseType, typename ExpType>
+void BM_PowBatch_T(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto bases = make_batch_data(get_bases<BaseType>(), n);
+    const auto exps = make_batch_data(get_exps<ExpType>(), n);
+    std::vector<BaseType> out(n);
+
+    for (auto _ : state) {
+        BatchFunc(std::span<const BaseType>(bases), std::span<const ExpType>(exps), std::span<BaseType>(out));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    ADD_BATCH_METRICS(state, bases, exps, out);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+
+// Batch benchmark with a single exponent broadcast to every element
+static constexpr uint32_t kBroadcastExp = 10;
+
+template <auto BatchFunc, typename BaseType, typename ExpType>
+void BM_PowBatchBroadcast_T(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto bases = make_batch_data(get_bases<BaseType>(), n);
+    const std::vector<ExpType> exps{static_cast<ExpType>(kBroadcastExp)};
+    std::vector<BaseType> out(n);
+
+    for (auto _ : state) {
+        BatchFunc(std::span<const BaseType>(bases), exps[0], std::span<BaseType>(out));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    ADD_BATCH_METRICS(state, bases, exps, out);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+
+// Latency mode: every call's result feeds the next call's base through an
+// opaque zero (base + result * zero), so calls cannot overlap and the time per
+// item is the kernel's latency plus one multiply and one add. The
+// identity_wrapper row measures that chain overhead on its own.
+template <auto PowFunc, typename BaseType, typename ExpType>
+void BM_PowLatency_T(benchmark::State& state) {
+    const auto& bases = get_bases<BaseType>();
+    const auto& exps = get_exps<ExpType>();
+    BaseType zero = 0;
+    benchmark::DoNotOptimize(zero);
+    BaseType carry = 0;
+
+    for (auto _ : state) {
+        for (auto base : bases) {
+            for (auto exp : exps) {
+                const auto result = PowFunc(static_cast<BaseType>(base + carry), exp);
+                carry = static_cast<BaseType>(result * zero);
+            }
+        }
+    }
+    benchmark::DoNotOptimize(carry);
+    state.SetItemsProcessed(state.iterations() * bases.size() * exps.size());
+}
+
+// Throughput mode: independent calls over arrays of state.range(0) elements with
+// results stored to memory, so the core overlaps as many calls as it can (and
+// the compiler may vectorize the loop if the kernel inlines branch-free)
+template <auto PowFunc, typename BaseType, typename ExpType>
+void BM_PowThroughput_T(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto bases = make_batch_data(get_bases<BaseType>(), n);
+    const auto exps = make_batch_data(get_exps<ExpType>(), n);
+    std::vector<decltype(PowFunc(BaseType{}, ExpType{}))> out(n);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = PowFunc(bases[i], exps[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+
+// Production-like inputs: state.range(0) picks the datasets::Distribution and
+// state.range(1) the number of (base, exp) pairs, from L1-resident to beyond LLC
+template <auto PowFunc, typename BaseType, typename ExpType>
+void BM_PowDistribution_T(benchmark::State& state) {
+    const auto distribution = static_cast<datasets::Distribution>(state.range(0));
+    const auto data = datasets::make_dataset<BaseType, ExpType>(distribution, static_cast<std::size_t>(state.range(1)));
+    if (data.empty()) {
+        state.SkipWithError("no trace: set POWERIX_TRACE to a file of 'base exp' lines");
+        return;
+    }
+    std::vector<decltype(PowFunc(BaseType{}, ExpType{}))> out(data.bases.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            out[i] = PowFunc(data.bases[i], data.exps[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetLabel(datasets::distribution_name(distribution));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(out.size()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(data.bytes()));
+}
+
+template<typename BaseType, typename ExpType>
+inline BaseType identity_wrapper(BaseType a, ExpType) {
+    return a;
+}
+
+// Scalar reference loop for the batch benchmarks
+template<typename BaseType, typename ExpType>
+inline void std_pow_batch_wrapper(std::span<const BaseType> bases, std::span<const ExpType> exps, std::span<BaseType> out) {
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = static_cast<BaseType>(std::pow(bases[i], exps[i]));
+    }
+}
+
+template<typename BaseType, typename ExpType>
+inline void hierarchical_batch_wrapper(std::span<const BaseType> bases, std::span<const ExpType> exps, std::span<BaseType> out) {
+    powerix::pow_hierarchical_batch(bases, exps, out);
+}
+
+template<typename BaseType, typename ExpType>
+inline void hierarchical_batch_broadcast_wrapper(std::span<const BaseType> bases, ExpType exp, std::span<BaseType> out) {
+    powerix::pow_hierarchical_batch(bases, exp, out);
+}
+
+template<typename BaseType, typename ExpType>
+inline void binary_batch_wrapper(std::span<const BaseType> bases, std::span<const ExpType> exps, std::span<BaseType> out) {
+    powerix::pow_binary_batch(bases, exps, out);
+}
+
+template<typename BaseType, typename ExpType>
+inline void binary_batch_broadcast_wrapper(std::span<const BaseType> bases, ExpType exp, std::span<BaseType> out) {
+    powerix::pow_binary_batch(bases, exp, out);
+}
+
+// Explicit SIMD kernels are skipped on CPUs without the required ISA
+template <auto BatchFunc, bool (*Supported)(), typename BaseType, typename ExpType>
+void BM_PowBatchSimd_T(benchmark::State& state) {
+    if (!Supported()) {
+        state.SkipWithError("ISA not supported on this CPU");
+        return;
+    }
+    BM_PowBatch_T<BatchFunc, BaseType, ExpType>(state);
+}
+
+template <auto BatchFunc, bool (*Supported)(), typename BaseType, typename ExpType>
+void BM_PowBatchBroadcastSimd_T(benchmark::State& state) {
+    if (!Supported()) {
+        state.SkipWithError("ISA not supported on this CPU");
+        return;
+    }
+    BM_PowBatchBroadcast_T<BatchFunc, BaseType, ExpType>(state);
+}
+
+inline bool always_supported() {
+    return true;
+}
+
+#if POWERIX_HAS_X86_SIMD
+inline void binary_sse4_wrapper(std::span<const double> bases, std::span<const uint32_t> exps, std::span<double> out) {
+    powerix::pow_binary_sse4(bases.data(), exps.data(), out.data(), out.size());
+}
+
+inline void binary_avx2_wrapper(std::span<const double> bases, std::span<const uint32_t> exps, std::span<double> out) {
+    powerix::pow_binary_avx2(bases.data(), exps.data(), out.data(), out.size());
+}
+
+inline void binary_avx2_broadcast_wrapper(std::span<const double> bases, uint32_t exp, std::span<double> out) {
+    powerix::pow_binary_avx2(bases.data(), exp, out.data(), out.size());
+}
+
+inline void binary_avx512_wrapper(std::span<const double> bases, std::span<const uint32_t> exps, std::span<double> out) {
+    powerix::pow_binary_avx512(bases.data(), exps.data(), out.data(), out.size());
+}
+
+inline void binary_avx512_broadcast_wrapper(std::span<const double> bases, uint32_t exp, std::span<double> out) {
+    powerix::pow_binary_avx512(bases.data(), exp, out.data(), out.size());
+}
+#endif
+
+inline void binary_simd_wrapper(std::span<const double> bases, std::span<const uint32_t> exps, std::span<double> out) {
+    powerix::pow_binary_batch_simd(bases, exps, out);
+}
+
+inline void binary_simd_broadcast_wrapper(std::span<const double> bases, uint32_t exp, std::span<double> out) {
+    powerix::pow_binary_batch_simd(bases, exp, out);
+}
+
+// Compile-time exponent against pow_ultra_fast with the same exponent at runtime
+template <unsigned N, typename BaseType>
+void BM_PowStatic_T(benchmark::State& state) {
+    auto func = [](BaseType a, uint32_t) {
+        return powerix::pow_static<N>(a);
+    };
+    const auto& bases = get_bases<BaseType>();
+    const std::vector<uint32_t> exps{N};
+
+    for (auto _ : state) {
+        run_dataset(func, bases, exps);
+    }
+    ADD_METRICS_AND_NS_PER_POW(state, func, bases, exps, ladder_ulp_bound);
+}
+
+template <unsigned N, typename BaseType>
+void BM_PowUltraFastFixed_T(benchmark::State& state) {
+    auto func = [](BaseType a, uint32_t b) {
+        return powerix::pow_ultra_fast(a, b);
+    };
+    const auto& bases = get_bases<BaseType>();
+    const std::vector<uint32_t> exps{N};
+
+    for (auto _ : state) {
+        run_dataset(func, bases, exps);
+    }
+    ADD_METRICS_AND_NS_PER_POW(state, func, bases, exps, ladder_ulp_bound);
+}
+
+inline void binary_dispatch_wrapper(std::span<const double> bases, std::span<const uint32_t> exps, std::span<double> out) {
+    powerix::pow_binary_dispatch(bases, exps, out);
+}
+
+// Every ISA in the dispatch table must return the scalar entry's bits, so a
+// dispatched result does not depend on the machine; empty when they all agree
+inline std::string dispatch_isa_mismatch() {
+    constexpr std::size_t n = 1003;  // not a multiple of any vector width, so tails run too
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> base_dist(0.5, 2.0);
+    std::uniform_int_distribution<uint32_t> exp_dist(0, 64);
+    std::vector<double> bases(n);
+    std::vector<uint32_t> exps(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        bases[i] = base_dist(rng);
+        exps[i] = exp_dist(rng);
+    }
+
+    const auto scalar = powerix::make_kernel_table(powerix::Isa::Scalar);
+    std::vector<double> expected(n);
+    std::vector<double> actual(n);
+    const auto differs = [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            if (std::bit_cast<uint64_t>(expected[i]) != std::bit_cast<uint64_t>(actual[i])) return true;
+        }
+        return false;
+    };
+    for (powerix::Isa isa : {powerix::Isa::SSE4, powerix::Isa::AVX2, powerix::Isa::AVX512}) {
+        if (!powerix::isa_supported(isa)) continue;
+        const auto table = powerix::make_kernel_table(isa);
+        scalar.binary(bases.data(), exps.data(), expected.data(), n);
+        table.binary(bases.data(), exps.data(), actual.data(), n);
+        if (differs()) return std::string(powerix::isa_name(isa)) + " kernel differs from scalar";
+        scalar.binary_broadcast(bases.data(), kBroadcastExp, expected.data(), n);
+        table.binary_broadcast(bases.data(), kBroadcastExp, actual.data(), n);
+        if (differs()) return std::string(powerix::isa_name(isa)) + " broadcast kernel differs from scalar";
+    }
+    return {};
+}
+
+// Dispatch overhead: the function-pointer call against a direct call of each kernel
+template <auto BatchFunc, bool (*Supported)()>
+void BM_PowDispatch_T(benchmark::State& state) {
+    static const std::string mismatch = dispatch_isa_mismatch();
+    if (!mismatch.empty()) {
+        state.SkipWithError(mismatch.c_str());
+        return;
+    }
+    state.SetLabel(powerix::isa_name(powerix::pow_kernels().isa));
+    BM_PowBatchSimd_T<BatchFunc, Supported, double, uint32_t>(state);
+}
+
+// Concurrent cache: hit-path throughput of PowCache shared by all benchmark threads
+constexpr uint32_t kCacheBases = 16;
+constexpr uint32_t kCacheExps = 32;
+
+template <typename Cache>
+Cache& get_warm_cache() {
+    static Cache cache;
+    static const bool warmed = [] {
+        for (uint32_t b = 0; b < kCacheBases; ++b) {
+            for (uint32_t e = 0; e < kCacheExps; ++e) {
+                cache.get(b + 2, e);
+            }
+        }
+        return true;
+    }();
+    (void)warmed;
+    return cache;
+}
+
+template <typename BaseType, typename ExpType, std::size_t Shards>
+void BM_PowCacheHit_T(benchmark::State& state) {
+    using Cache = powerix::PowCache<BaseType, ExpType, Shards>;
+    Cache& cache = get_warm_cache<Cache>();
+
+    // Each thread walks the key set from a different offset
+    uint32_t k = static_cast<uint32_t>(state.thread_index()) * 37u;
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < kCacheBases * kCacheExps; ++i, ++k) {
+            const uint32_t key = k % (kCacheBases * kCacheExps);
+            benchmark::DoNotOptimize(cache.get(static_cast<BaseType>(key / kCacheExps + 2), static_cast<ExpType>(key % kCacheExps)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kCacheBases * kCacheExps);
+}
+
+// Bounded cache under a Zipfian (base, exp) stream: hit rate vs capacity
+constexpr uint32_t kZipfExps = 64;
+constexpr uint32_t kZipfKeys = 1u << 16;
+constexpr std::size_t kZipfTraceLength = 1u << 18;
+
+// Key ranks drawn with P(rank) ~ 1 / rank^s, mapped to (base, exp) pairs
+inline const std::vector<uint32_t>& get_zipf_trace(double s) {
+    static std::unordered_map<double, std::vector<uint32_t>> traces;
+    auto it = traces.find(s);
+    if (it != traces.end()) {
+        return it->second;
+    }
+    return traces.emplace(s, datasets::zipf_ranks(kZipfKeys, s, kZipfTraceLength, 42)).first->second;
+}
+
+template <typename BaseType>
+void BM_PowBoundedCacheZipf_T(benchmark::State& state) {
+    const std::size_t capacity = static_cast<std::size_t>(state.range(0));
+    const double s = static_cast<double>(state.range(1)) / 100.0;
+    const auto& trace = get_zipf_trace(s);
+    powerix::BoundedPowCache<BaseType, uint32_t> cache(capacity);
+
+    // One untimed pass so the counters reflect the steady state
+    for (uint32_t key : trace) {
+        cache.get(static_cast<BaseType>(key / kZipfExps + 2), key % kZipfExps);
+    }
+    cache.reset_stats();
+
+    for (auto _ : state) {
+        for (uint32_t key : trace) {
+            benchmark::DoNotOptimize(cache.get(static_cast<BaseType>(key / kZipfExps + 2), key % kZipfExps));
+        }
+    }
+
+    const auto stats = cache.stats();
+    const double lookups = static_cast<double>(stats.hits + stats.misses);
+    state.counters["HitRate"] = static_cast<double>(stats.hits) / lookups;
+    state.counters["Evictions"] = benchmark::Counter(static_cast<double>(stats.evictions), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(state.iterations() * trace.size());
+}
+
+// Precomputed table vs lazily filled static array, random lookups inside the range
+template <std::size_t MaxBase, std::size_t MaxExp>
+const std::vector<std::pair<uint32_t, uint32_t>>& get_table_lookups() {
+    static const auto lookups = [] {
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<uint32_t> base(0, MaxBase - 1);
+        std::uniform_int_distribution<uint32_t> exp(0, MaxExp - 1);
+        std::vector<std::pair<uint32_t, uint32_t>> pairs(4096);
+        for (auto& p : pairs) {
+            p = {base(rng), exp(rng)};
+        }
+        return pairs;
+    }();
+    return lookups;
+}
+
+template <typename BaseType, std::size_t MaxBase, std::size_t MaxExp>
+void BM_PowTable_T(benchmark::State& state) {
+    const auto& table = powerix::pow_table<BaseType, MaxBase, MaxExp>;
+    const auto& lookups = get_table_lookups<MaxBase, MaxExp>();
+
+    for (auto _ : state) {
+        for (auto [b, e] : lookups) {
+            benchmark::DoNotOptimize(table(static_cast<BaseType>(b), e));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * lookups.size());
+}
+
+template <typename BaseType, std::size_t MaxBase, std::size_t MaxExp>
+void BM_PowStaticArray_T(benchmark::State& state) {
+    const auto& lookups = get_table_lookups<MaxBase, MaxExp>();
+
+    for (auto _ : state) {
+        for (auto [b, e] : lookups) {
+            benchmark::DoNotOptimize(powerix::pow_cached_static_array<BaseType, uint32_t, MaxBase, MaxExp>(static_cast<BaseType>(b), e));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * lookups.size());
+}
+
+// Overflow dataset: roughly half of the (base, exp) pairs overflow 32-bit types
+static const std::vector<uint32_t> kOverflowBases{2, 3, 7, 10, 255, 1000, 65535};
+static const std::vector<uint32_t> kOverflowExps{3, 5, 10, 20, 31, 40, 63, 64};
+
+template <auto PowFunc, typename BaseType, typename ExpType>
+void BM_PowOverflow_T(benchmark::State& state) {
+    const std::vector<BaseType> bases(kOverflowBases.begin(), kOverflowBases.end());
+    const std::vector<ExpType> exps(kOverflowExps.begin(), kOverflowExps.end());
+
+    for (auto _ : state) {
+        volatile BaseType sink = 0;
+        for (auto base : bases) {
+            for (auto exp : exps) {
+                sink = sink + PowFunc(base, exp);
+            }
+        }
+        benchmark::DoNotOptimize(sink);
+    }
+
+    long overflows = 0;
+    for (auto base : bases) {
+        for (auto exp : exps) {
+            overflows += !powerix::pow_checked(base, exp).has_value();
+        }
+    }
+    state.counters["Overflows"] = static_cast<double>(overflows);
+    state.SetItemsProcessed(state.iterations() * bases.size() * exps.size());
+}
+
+// Signed datasets: negative bases and negative exponents
+static const std::vector<int32_t> kSignedIntBases{-5, -3, -2, -1, 1, 2, 3, 5};
+static const std::vector<double> kSignedDoubleBases{-2.7, -1.3, -0.5, 0.1, 0.5, 1.3, 2.7, 5.9};
+static const std::vector<int32_t> kSignedExps{-10, -5, -3, -1, 0, 1, 2, 3, 5, 10};
+
+// Reference for integer bases is the quotient truncated toward zero
+template <auto PowFunc, typename BaseType, typename ExpType, auto UlpBound = ladder_ulp_bound>
+void BM_PowSigned_T(benchmark::State& state) {
+    auto func = [](BaseType a, ExpType b) {
+        return PowFunc(a, b);
+    };
+    std::vector<BaseType> bases;
+    if constexpr (std::is_integral_v<BaseType>) {
+        bases.assign(kSignedIntBases.begin(), kSignedIntBases.end());
+    } else {
+        bases.assign(kSignedDoubleBases.begin(), kSignedDoubleBases.end());
+    }
+    const std::vector<ExpType> exps(kSignedExps.begin(), kSignedExps.end());
+
+    for (auto _ : state) {
+        run_dataset(func, bases, exps);
+    }
+
+    powerix::UlpContract contract;
+    double max_rel_err = 0.0;
+    for (auto base : bases) {
+        for (auto exp : exps) {
+            long double reference = powerix::reference_pow(base, exp);
+            if constexpr (std::is_integral_v<BaseType>) {
+                reference = std::trunc(reference);
+            }
+            const auto error = powerix::compute_error(reference, func(base, exp));
+            max_rel_err = std::max(max_rel_err, error.rel_err);
+            contract.add(base, exp, error.ulp_err, UlpBound(base, exp));
+        }
+    }
+    state.counters["MaxRelErr"] = max_rel_err;
+    state.counters["MaxUlp"] = contract.max_ulp;
+    if (contract.violated) state.SkipWithError(contract.message().c_str());
+    state.SetItemsProcessed(state.iterations() * bases.size() * exps.size());
+}
+
+// Monoid exponentiation: the generic ladders on std::complex and Eigen types,
+// against std::pow and Eigen's MatrixPower. Bases have norm near 1 so powers
+// up to 256 neither overflow nor vanish.
+static const std::vector<uint32_t> kMonoidExps{2, 3, 7, 16, 31, 64, 100, 256};
+
+template <typename T>
+const std::vector<T>& get_monoid_bases() {
+    static const auto bases = [] {
+        std::vector<T> values;
+        std::mt19937_64 rng(5);
+        std::uniform_real_distribution<double> unit(-1.0, 1.0);
+        for (int i = 0; i < 4; ++i) {
+            if constexpr (std::is_same_v<T, std::complex<double>>) {
+                values.push_back(std::polar(1.0 + 0.01 * unit(rng), 3.0 * unit(rng)));
+            }
+#if POWERIX_HAS_EIGEN
+            else if constexpr (std::is_same_v<T, Eigen::Quaterniond>) {
+                values.push_back(Eigen::Quaterniond(Eigen::Vector4d::NullaryExpr([&] { return unit(rng); })).normalized());
+            } else {
+                // Random matrix scaled to spectral radius 1
+                T m = T::NullaryExpr([&] { return unit(rng); });
+                const auto radius = m.eigenvalues().cwiseAbs().maxCoeff();
+                values.push_back(m / radius);
+            }
+#endif
+        }
+        return values;
+    }();
+    return bases;
+}
+
+// Relative error in the 2-norm against the same ladder run in long double
+template <typename T>
+double monoid_rel_error(const T& base, uint32_t exp, const T& value) {
+    if constexpr (std::is_same_v<T, std::complex<double>>) {
+        const auto reference = powerix::pow_binary(std::complex<long double>(base), exp);
+        return static_cast<double>(std::abs(std::complex<long double>(value) - reference) / std::abs(reference));
+    }
+#if POWERIX_HAS_EIGEN
+    else if constexpr (std::is_same_v<T, Eigen::Quaterniond>) {
+        const auto reference = powerix::pow_binary(base.template cast<long double>(), exp);
+        return static_cast<double>((value.template cast<long double>().coeffs() - reference.coeffs()).norm() / reference.coeffs().norm());
+    } else {
+        const auto reference = powerix::pow_binary(base.template cast<long double>().eval(), exp);
+        return static_cast<double>((value.template cast<long double>() - reference).norm() / reference.norm());
+    }
+#endif
+}
+
+template <typename T>
+inline T monoid_binary_wrapper(const T& base, uint32_t exp) {
+    return powerix::pow_binary(base, exp);
+}
+
+template <typename T>
+inline T monoid_hierarchical_wrapper(const T& base, uint32_t exp) {
+    return powerix::pow_hierarchical(base, exp);
+}
+
+// std::pow(complex, int) promotes the exponent and goes through exp/log
+inline std::complex<double> complex_std_pow_wrapper(const std::complex<double>& base, uint32_t exp) {
+    return std::pow(base, static_cast<double>(exp));
+}
+
+#if POWERIX_HAS_EIGEN_MATRIX_POWER
+// MatrixPower splits off the integer part of the exponent and squares the
+// matrix itself; the fractional part (here 0) would need a Schur decomposition
+template <typename T>
+inline T eigen_matrix_power_wrapper(const T& base, uint32_t exp) {
+    return base.pow(static_cast<double>(exp));
+}
+#endif
+
+template <auto PowFunc, typename T>
+void BM_PowMonoid_T(benchmark::State& state) {
+    const auto& bases = get_monoid_bases<T>();
+
+    for (auto _ : state) {
+        for (const T& base : bases) {
+            for (uint32_t exp : kMonoidExps) {
+                T result = PowFunc(base, exp);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+
+    double max_rel_err = 0.0;
+    for (const T& base : bases) {
+        for (uint32_t exp : kMonoidExps) {
+            max_rel_err = std::max(max_rel_err, monoid_rel_error(base, exp, PowFunc(base, exp)));
+        }
+    }
+    state.counters["MaxRelErr"] = max_rel_err;
+    state.SetItemsProcessed(state.iterations() * bases.size() * kMonoidExps.size());
+}
+
+// Vandermonde blocks: 1K bases (the double dataset cycled) times powers 0..degree,
+// from the all-powers generator or one independent pow call per element
+constexpr std::size_t kVandermondeBases = 1u << 10;
+
+template <powerix::VandermondeLayout Layout>
+inline void vandermonde_wrapper(std::span<const double> bases, std::size_t degree, std::span<double> out) {
+    powerix::pow_vandermonde<Layout>(bases, degree, out);
+}
+
+template <auto PowFunc>
+inline void vandermonde_per_element_wrapper(std::span<const double> bases, std::size_t degree, std::span<double> out) {
+    const std::size_t columns = degree + 1;
+    for (std::size_t i = 0; i < bases.size(); ++i) {
+        for (std::size_t k = 0; k < columns; ++k) {
+            out[i * columns + k] = PowFunc(bases[i], static_cast<uint32_t>(k));
+        }
+    }
+}
+
+template <auto VandermondeFunc, powerix::VandermondeLayout Layout>
+void BM_PowVandermonde_T(benchmark::State& state) {
+    const std::size_t degree = static_cast<std::size_t>(state.range(0));
+    const auto bases = make_batch_data(get_bases<double>(), kVandermondeBases);
+    std::vector<double> out(bases.size() * (degree + 1));
+
+    for (auto _ : state) {
+        VandermondeFunc(std::span<const double>(bases), degree, std::span<double>(out));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    powerix::UlpContract contract;
+    for (std::size_t i = 0; i < bases.size(); ++i) {
+        for (std::size_t k = 0; k <= degree; ++k) {
+            const double value = Layout == powerix::VandermondeLayout::RowMajor ? out[i * (degree + 1) + k] : out[k * bases.size() + i];
+            const auto error = powerix::compute_error(powerix::reference_pow(bases[i], static_cast<long double>(k)), value);
+            contract.add(bases[i], static_cast<double>(k), error.ulp_err, powerix::pow_ladder_ulp_bound(static_cast<double>(k)));
+        }
+    }
+    state.counters["MaxUlp"] = contract.max_ulp;
+    if (contract.violated) state.SkipWithError(contract.message().c_str());
+    state.SetItemsProcessed(state.iterations() * out.size());
+}
+
+// Polynomial evaluation: sum c[k] x^k with c[k] = 1/k! (a truncated exp)
+// over the double dataset, one pow call per term vs Horner and Estrin
+template <std::size_t N>
+const std::array<double, N>& get_poly_coeffs() {
+    static const auto coeffs = [] {
+        std::array<double, N> c;
+        long double factorial = 1.0L;
+        for (std::size_t k = 0; k < N; ++k) {
+            factorial *= k == 0 ? 1 : k;
+            c[k] = static_cast<double>(1.0L / factorial);
+        }
+        return c;
+    }();
+    return coeffs;
+}
+
+template <auto PowFunc, std::size_t N>
+inline double poly_pow_per_term_wrapper(const std::array<double, N>& coeffs, double x) {
+    double sum = 0.0;
+    for (std::size_t k = 0; k < N; ++k) {
+        sum += coeffs[k] * PowFunc(x, static_cast<uint32_t>(k));
+    }
+    return sum;
+}
+
+template <auto PowFunc, std::size_t N>
+inline void poly_pow_per_term_batch_wrapper(const std::array<double, N>& coeffs, std::span<const double> xs, std::span<double> out) {
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = poly_pow_per_term_wrapper<PowFunc>(coeffs, xs[i]);
+    }
+}
+
+template <powerix::PolyScheme Scheme, std::size_t N>
+inline double poly_eval_wrapper(const std::array<double, N>& coeffs, double x) {
+    return powerix::poly_eval<Scheme>(coeffs, x);
+}
+
+template <powerix::PolyScheme Scheme, std::size_t N>
+inline void poly_eval_batch_wrapper(const std::array<double, N>& coeffs, std::span<const double> xs, std::span<double> out) {
+    powerix::poly_eval_batch<Scheme>(coeffs, xs, out);
+}
+
+template <std::size_t N>
+long double poly_reference(const std::array<double, N>& coeffs, double x) {
+    long double sum = 0.0L;
+    for (std::size_t k = N; k-- > 0;) {
+        sum = sum * x + coeffs[k];
+    }
+    return sum;
+}
+
+// Contract of the pow-per-term loops (Horner and Estrin are held to
+// powerix::poly_eval_ulp_bound): N - 1 additions on top of each term's pow
+// error (the ladder's or libm's) and its multiply by c[k]. All terms of the
+// truncated exp share a sign, so the condition number is 1.
+template <std::size_t N>
+inline double poly_per_term_ulp_bound(const std::array<double, N>&, double) {
+    const double pow_ulp = std::max(powerix::pow_ladder_ulp_bound(static_cast<double>(N - 1)), powerix::kLibmPowUlpBound);
+    return static_cast<double>(N - 1) + pow_ulp + 1.0;
+}
+
+// Throughput of a batch evaluation over state.range(0) inputs; every output is
+// checked against a long double Horner and the row fails past UlpBound
+template <auto PolyBatchFunc, std::size_t N, auto UlpBound>
+void BM_PolyEval_T(benchmark::State& state) {
+    const auto& coeffs = get_poly_coeffs<N>();
+    const auto xs = make_batch_data(get_bases<double>(), static_cast<std::size_t>(state.range(0)));
+    std::vector<double> out(xs.size());
+
+    for (auto _ : state) {
+        PolyBatchFunc(coeffs, std::span<const double>(xs), std::span<double>(out));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    double max_rel_err = 0.0;
+    powerix::UlpContract contract;
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        const auto error = powerix::compute_error(poly_reference(coeffs, xs[i]), out[i]);
+        max_rel_err = std::max(max_rel_err, error.rel_err);
+        contract.add(xs[i], error.ulp_err, UlpBound(coeffs, xs[i]));
+    }
+    state.counters["MaxRelErr"] = max_rel_err;
+    state.counters["MaxUlp"] = contract.max_ulp;
+    if (contract.violated) state.SkipWithError(contract.message().c_str());
+    state.SetItemsProcessed(state.iterations() * out.size());
+}
+
+// Latency: each result feeds the next input through an opaque zero, as in BM_PowLatency_T
+template <auto PolyFunc, std::size_t N>
+void BM_PolyLatency_T(benchmark::State& state) {
+    const auto& coeffs = get_poly_coeffs<N>();
+    const auto& xs = get_bases<double>();
+    double zero = 0.0;
+    benchmark::DoNotOptimize(zero);
+    double carry = 0.0;
+
+    for (auto _ : state) {
+        for (double x : xs) {
+            carry = PolyFunc(coeffs, x + carry) * zero;
+        }
+    }
+    benchmark::DoNotOptimize(carry);
+    state.SetItemsProcessed(state.iterations() * xs.size());
+}
+
+// Large exponents: bases in [1/2, 2) and exponents in [0, 512), where the
+// plain ladder's error grows with the exponent; results stay in [2^-512, 2^512)
+constexpr std::size_t kLargeExpPairs = 4096;
+
+inline const datasets::PowDataset<double, uint32_t>& get_large_exp_data() {
+    static const auto data = [] {
+        datasets::PowDataset<double, uint32_t> pairs;
+        std::mt19937_64 rng(11);
+        std::uniform_real_distribution<double> base(0.5, 2.0);
+        std::uniform_int_distribution<uint32_t> exp(0, 511);
+        for (std::size_t i = 0; i < kLargeExpPairs; ++i) {
+            pairs.bases.push_back(base(rng));
+            pairs.exps.push_back(exp(rng));
+        }
+        return pairs;
+    }();
+    return data;
+}
+
+template <auto PowFunc, auto UlpBound>
+void BM_PowLargeExp_T(benchmark::State& state) {
+    const auto& data = get_large_exp_data();
+    std::vector<double> out(data.bases.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            out[i] = PowFunc(data.bases[i], data.exps[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    powerix::UlpContract contract;
+    double max_rel_err = 0.0;
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        const auto error = powerix::compute_error(powerix::reference_pow(data.bases[i], data.exps[i]), out[i]);
+        max_rel_err = std::max(max_rel_err, error.rel_err);
+        contract.add(data.bases[i], data.exps[i], error.ulp_err, UlpBound(data.bases[i], data.exps[i]));
+    }
+    state.counters["MaxRelErr"] = max_rel_err;
+    state.counters["MaxUlp"] = contract.max_ulp;
+    if (contract.violated) state.SkipWithError(contract.message().c_str());
+    state.SetItemsProcessed(state.iterations() * out.size());
+}
+
+// Multi-core scaling of parallel_pow over 16M uniform double^uint32 pairs;
+// state.range(0) is the thread count, the output is first-touched by the pool
+constexpr std::size_t kParallelElements = 1u << 24;
+
+template <typename BaseType, typename ExpType>
+void BM_ParallelPow_T(benchmark::State& state) {
+    static const auto data = datasets::make_dataset<BaseType, ExpType>(datasets::Distribution::Uniform, kParallelElements);
+    powerix::ThreadPool pool(static_cast<unsigned>(state.range(0)), true);
+    auto out = powerix::make_first_touch_array<BaseType>(kParallelElements, pool);
+    const std::span<BaseType> out_span(out.get(), kParallelElements);
+
+    for (auto _ : state) {
+        powerix::parallel_pow(std::span<const BaseType>(data.bases), std::span<const ExpType>(data.exps), out_span, pool);
+        benchmark::DoNotOptimize(out.get());
+        benchmark::ClobberMemory();
+    }
+    if (!pool.pinned()) state.SetLabel("unpinned");
+    state.SetItemsProcessed(state.iterations() * kParallelElements);
+    state.SetBytesProcessed(state.iterations() * kParallelElements * (2 * sizeof(BaseType) + sizeof(ExpType)));
+}
+
+// Thread counts 1, 2, 4, ... up to and including every hardware thread
+inline void parallel_thread_counts(benchmark::internal::Benchmark* b) {
+    const int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    for (int threads = 1; threads < cores; threads *= 2) {
+        b->Arg(threads);
+    }
+    b->Arg(cores);
+}
+
 // Register all benchmarks
 // Standard pow (all types)
-BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<uint16_t,uint16_t>, uint16_t, uint16_t);
-BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<uint32_t,uint32_t>, uint32_t, uint32_t);
-BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<uint64_t,uint64_t>, uint64_t, uint64_t);
-BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<float,float>, float, float);
-BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<double,double>, double, double);
-BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<float,uint32_t>, float, uint32_t);
-BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<double,uint32_t>, double, uint32_t);
-BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<double,float>, double, float);
-BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<float,double>, float, double);
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<uint16_t,uint16_t>, uint16_t, uint16_t, libm_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<uint32_t,uint32_t>, uint32_t, uint32_t, libm_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<uint64_t,uint64_t>, uint64_t, uint64_t, libm_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<float,float>, float, float, libm_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<double,double>, double, double, libm_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<float,uint32_t>, float, uint32_t, libm_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<double,uint32_t>, double, uint32_t, libm_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<double,float>, double, float, libm_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, std_pow_wrapper<float,double>, float, double, libm_ulp_bound);
 
 // C raw pow function wrapper
-BENCHMARK_TEMPLATE(BM_PowGeneric_T, pow_c_raw_wrapper<float,float>, float, float);
-BENCHMARK_TEMPLATE(BM_PowGeneric_T, pow_c_raw_wrapper<double,double>, double, double);
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, pow_c_raw_wrapper<float,float>, float, float, libm_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, pow_c_raw_wrapper<double,double>, double, double, libm_ulp_bound);
 
 // Binary exponentiation (integer types only)
 BENCHMARK_TEMPLATE(BM_PowGeneric_T, pow_binary_wrapper<uint16_t, uint16_t>, uint16_t, uint16_t);
@@ -181,6 +1062,15 @@ BENCHMARK_TEMPLATE(BM_PowGeneric_T, hierarchical_pow_wrapper<uint16_t, uint16_t>
 BENCHMARK_TEMPLATE(BM_PowGeneric_T, hierarchical_pow_wrapper<uint32_t, uint32_t>, uint32_t, uint32_t);
 BENCHMARK_TEMPLATE(BM_PowGeneric_T, hierarchical_pow_wrapper<uint64_t, uint64_t>, uint64_t, uint64_t);
 
+// Overflow-checked and saturating exponentiation (integer types only)
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, pow_checked_wrapper<uint16_t, uint16_t>, uint16_t, uint16_t);
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, pow_checked_wrapper<uint32_t, uint32_t>, uint32_t, uint32_t);
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, pow_checked_wrapper<uint64_t, uint64_t>, uint64_t, uint64_t);
+
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, pow_saturating_wrapper<uint16_t, uint16_t>, uint16_t, uint16_t);
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, pow_saturating_wrapper<uint32_t, uint32_t>, uint32_t, uint32_t);
+BENCHMARK_TEMPLATE(BM_PowGeneric_T, pow_saturating_wrapper<uint64_t, uint64_t>, uint64_t, uint64_t);
+
 // Ultra-fast binary exponentiation (integer types only)
 BENCHMARK_TEMPLATE(BM_PowGeneric_T, pow_ultra_fast_wrapper<uint16_t, uint16_t>, uint16_t, uint16_t);
 BENCHMARK_TEMPLATE(BM_PowGeneric_T, pow_ultra_fast_wrapper<uint32_t, uint32_t>, uint32_t, uint32_t);
@@ -207,4 +1097,174 @@ BENCHMARK_TEMPLATE(BM_PowGeneric_T, cached_static_array_wrapper<uint16_t, uint16
 BENCHMARK_TEMPLATE(BM_PowGeneric_T, cached_static_array_wrapper<uint32_t, uint32_t>, uint32_t, uint32_t);
 BENCHMARK_TEMPLATE(BM_PowGeneric_T, cached_static_array_wrapper<uint64_t, uint64_t>, uint64_t, uint64_t);
 
+// Batched kernels over arrays: 1K, 64K and 16M elements
+#define POWERIX_BATCH_SIZES Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 24)
+
+BENCHMARK_TEMPLATE(BM_PowBatch_T, std_pow_batch_wrapper<double, uint32_t>, double, uint32_t)->POWERIX_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatch_T, hierarchical_batch_wrapper<double, uint32_t>, double, uint32_t)->POWERIX_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatch_T, hierarchical_batch_wrapper<uint64_t, uint32_t>, uint64_t, uint32_t)->POWERIX_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatch_T, binary_batch_wrapper<double, uint32_t>, double, uint32_t)->POWERIX_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatch_T, binary_batch_wrapper<uint64_t, uint32_t>, uint64_t, uint32_t)->POWERIX_BATCH_SIZES;
+
+BENCHMARK_TEMPLATE(BM_PowBatchBroadcast_T, hierarchical_batch_broadcast_wrapper<double, uint32_t>, double, uint32_t)->POWERIX_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatchBroadcast_T, hierarchical_batch_broadcast_wrapper<uint64_t, uint32_t>, uint64_t, uint32_t)->POWERIX_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatchBroadcast_T, binary_batch_broadcast_wrapper<double, uint32_t>, double, uint32_t)->POWERIX_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatchBroadcast_T, binary_batch_broadcast_wrapper<uint64_t, uint32_t>, uint64_t, uint32_t)->POWERIX_BATCH_SIZES;
+
+// Explicit SIMD kernels for double^uint32
+BENCHMARK_TEMPLATE(BM_PowBatchSimd_T, binary_simd_wrapper, always_supported, double, uint32_t)->POWERIX_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatchBroadcastSimd_T, binary_simd_broadcast_wrapper, always_supported, double, uint32_t)->POWERIX_BATCH_SIZES;
+#if POWERIX_HAS_X86_SIMD
+BENCHMARK_TEMPLATE(BM_PowBatchSimd_T, binary_avx2_wrapper, powerix::cpu_supports_avx2, double, uint32_t)->POWERIX_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatchSimd_T, binary_avx512_wrapper, powerix::cpu_supports_avx512, double, uint32_t)->POWERIX_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatchBroadcastSimd_T, binary_avx2_broadcast_wrapper, powerix::cpu_supports_avx2, double, uint32_t)->POWERIX_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatchBroadcastSimd_T, binary_avx512_broadcast_wrapper, powerix::cpu_supports_avx512, double, uint32_t)->POWERIX_BATCH_SIZES;
+#endif
+
+// Distribution datasets: uniform, Zipf, log-uniform and trace replay at 1K to 4M pairs
+BENCHMARK_TEMPLATE(BM_PowDistribution_T, std_pow_wrapper<double, uint32_t>, double, uint32_t)->POWERIX_DATASET_ARGS;
+BENCHMARK_TEMPLATE(BM_PowDistribution_T, pow_binary_wrapper<double, uint32_t>, double, uint32_t)->POWERIX_DATASET_ARGS;
+BENCHMARK_TEMPLATE(BM_PowDistribution_T, hierarchical_pow_wrapper<double, uint32_t>, double, uint32_t)->POWERIX_DATASET_ARGS;
+BENCHMARK_TEMPLATE(BM_PowDistribution_T, pow_ultra_fast_wrapper<double, uint32_t>, double, uint32_t)->POWERIX_DATASET_ARGS;
+BENCHMARK_TEMPLATE(BM_PowDistribution_T, pow_binary_wrapper<uint64_t, uint32_t>, uint64_t, uint32_t)->POWERIX_DATASET_ARGS;
+BENCHMARK_TEMPLATE(BM_PowDistribution_T, hierarchical_pow_wrapper<uint64_t, uint32_t>, uint64_t, uint32_t)->POWERIX_DATASET_ARGS;
+BENCHMARK_TEMPLATE(BM_PowDistribution_T, pow_ultra_fast_wrapper<uint64_t, uint32_t>, uint64_t, uint32_t)->POWERIX_DATASET_ARGS;
+BENCHMARK_TEMPLATE(BM_PowDistribution_T, cached_vector_optional_wrapper<uint64_t, uint32_t>, uint64_t, uint32_t)->POWERIX_DATASET_ARGS;
+BENCHMARK_TEMPLATE(BM_PowDistribution_T, cached_static_array_wrapper<uint64_t, uint32_t>, uint64_t, uint32_t)->POWERIX_DATASET_ARGS;
+BENCHMARK_TEMPLATE(BM_PowDistribution_T, std_pow_wrapper<double, double>, double, double)->POWERIX_DATASET_ARGS;
+BENCHMARK_TEMPLATE(BM_PowDistribution_T, pow_c_raw_wrapper<double, double>, double, double)->POWERIX_DATASET_ARGS;
+
+// Latency (dependent chain) vs throughput (independent calls over arrays)
+#define POWERIX_LATENCY_THROUGHPUT(func, BaseType, ExpType) \
+    BENCHMARK_TEMPLATE(BM_PowLatency_T, func<BaseType, ExpType>, BaseType, ExpType); \
+    BENCHMARK_TEMPLATE(BM_PowThroughput_T, func<BaseType, ExpType>, BaseType, ExpType)->POWERIX_BATCH_SIZES
+
+POWERIX_LATENCY_THROUGHPUT(identity_wrapper, double, uint32_t);
+POWERIX_LATENCY_THROUGHPUT(std_pow_wrapper, double, uint32_t);
+POWERIX_LATENCY_THROUGHPUT(pow_binary_wrapper, double, uint32_t);
+POWERIX_LATENCY_THROUGHPUT(hierarchical_pow_wrapper, double, uint32_t);
+POWERIX_LATENCY_THROUGHPUT(pow_ultra_fast_wrapper, double, uint32_t);
+POWERIX_LATENCY_THROUGHPUT(identity_wrapper, uint64_t, uint32_t);
+POWERIX_LATENCY_THROUGHPUT(pow_binary_wrapper, uint64_t, uint32_t);
+POWERIX_LATENCY_THROUGHPUT(hierarchical_pow_wrapper, uint64_t, uint32_t);
+POWERIX_LATENCY_THROUGHPUT(pow_ultra_fast_wrapper, uint64_t, uint32_t);
+POWERIX_LATENCY_THROUGHPUT(std_pow_wrapper, double, double);
+POWERIX_LATENCY_THROUGHPUT(pow_c_raw_wrapper, double, double);
+
+// Compile-time exponents: shortest addition chain vs runtime pow_ultra_fast
+BENCHMARK_TEMPLATE(BM_PowStatic_T, 2, double);
+BENCHMARK_TEMPLATE(BM_PowUltraFastFixed_T, 2, double);
+BENCHMARK_TEMPLATE(BM_PowStatic_T, 3, double);
+BENCHMARK_TEMPLATE(BM_PowUltraFastFixed_T, 3, double);
+BENCHMARK_TEMPLATE(BM_PowStatic_T, 5, double);
+BENCHMARK_TEMPLATE(BM_PowUltraFastFixed_T, 5, double);
+BENCHMARK_TEMPLATE(BM_PowStatic_T, 7, double);
+BENCHMARK_TEMPLATE(BM_PowUltraFastFixed_T, 7, double);
+BENCHMARK_TEMPLATE(BM_PowStatic_T, 8, double);
+BENCHMARK_TEMPLATE(BM_PowUltraFastFixed_T, 8, double);
+BENCHMARK_TEMPLATE(BM_PowStatic_T, 15, double);
+BENCHMARK_TEMPLATE(BM_PowUltraFastFixed_T, 15, double);
+BENCHMARK_TEMPLATE(BM_PowStatic_T, 23, double);
+BENCHMARK_TEMPLATE(BM_PowUltraFastFixed_T, 23, double);
+BENCHMARK_TEMPLATE(BM_PowStatic_T, 31, double);
+BENCHMARK_TEMPLATE(BM_PowUltraFastFixed_T, 31, double);
+BENCHMARK_TEMPLATE(BM_PowStatic_T, 63, double);
+BENCHMARK_TEMPLATE(BM_PowUltraFastFixed_T, 63, double);
+BENCHMARK_TEMPLATE(BM_PowStatic_T, 127, double);
+BENCHMARK_TEMPLATE(BM_PowUltraFastFixed_T, 127, double);
+BENCHMARK_TEMPLATE(BM_PowStatic_T, 255, double);
+BENCHMARK_TEMPLATE(BM_PowUltraFastFixed_T, 255, double);
+
+// Runtime dispatch against direct kernel calls, at sizes where call overhead shows
+#define POWERIX_DISPATCH_SIZES Arg(8)->Arg(64)->Arg(1 << 10)
+
+BENCHMARK_TEMPLATE(BM_PowDispatch_T, binary_dispatch_wrapper, always_supported)->POWERIX_DISPATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowDispatch_T, binary_batch_wrapper<double, uint32_t>, always_supported)->POWERIX_DISPATCH_SIZES;
+#if POWERIX_HAS_X86_SIMD
+BENCHMARK_TEMPLATE(BM_PowDispatch_T, binary_sse4_wrapper, powerix::cpu_supports_sse4)->POWERIX_DISPATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowDispatch_T, binary_avx2_wrapper, powerix::cpu_supports_avx2)->POWERIX_DISPATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowDispatch_T, binary_avx512_wrapper, powerix::cpu_supports_avx512)->POWERIX_DISPATCH_SIZES;
+#endif
+
+// Monoid types: generic ladders vs std::pow on complex and Eigen's MatrixPower
+BENCHMARK_TEMPLATE(BM_PowMonoid_T, complex_std_pow_wrapper, std::complex<double>);
+BENCHMARK_TEMPLATE(BM_PowMonoid_T, monoid_binary_wrapper<std::complex<double>>, std::complex<double>);
+BENCHMARK_TEMPLATE(BM_PowMonoid_T, monoid_hierarchical_wrapper<std::complex<double>>, std::complex<double>);
+#if POWERIX_HAS_EIGEN
+BENCHMARK_TEMPLATE(BM_PowMonoid_T, monoid_binary_wrapper<Eigen::Quaterniond>, Eigen::Quaterniond);
+BENCHMARK_TEMPLATE(BM_PowMonoid_T, monoid_binary_wrapper<Eigen::Matrix2d>, Eigen::Matrix2d);
+BENCHMARK_TEMPLATE(BM_PowMonoid_T, monoid_hierarchical_wrapper<Eigen::Matrix2d>, Eigen::Matrix2d);
+BENCHMARK_TEMPLATE(BM_PowMonoid_T, monoid_binary_wrapper<Eigen::Matrix4d>, Eigen::Matrix4d);
+BENCHMARK_TEMPLATE(BM_PowMonoid_T, monoid_hierarchical_wrapper<Eigen::Matrix4d>, Eigen::Matrix4d);
+#if POWERIX_HAS_EIGEN_MATRIX_POWER
+BENCHMARK_TEMPLATE(BM_PowMonoid_T, eigen_matrix_power_wrapper<Eigen::Matrix2d>, Eigen::Matrix2d);
+BENCHMARK_TEMPLATE(BM_PowMonoid_T, eigen_matrix_power_wrapper<Eigen::Matrix4d>, Eigen::Matrix4d);
+#endif
+#endif
+
+// All powers 0..degree of 1K bases: generator vs one pow call per element
+#define POWERIX_VANDERMONDE_DEGREES Arg(8)->Arg(32)->Arg(128)
+
+BENCHMARK_TEMPLATE(BM_PowVandermonde_T, vandermonde_per_element_wrapper<hierarchical_pow_wrapper<double, uint32_t>>, powerix::VandermondeLayout::RowMajor)->POWERIX_VANDERMONDE_DEGREES;
+BENCHMARK_TEMPLATE(BM_PowVandermonde_T, vandermonde_per_element_wrapper<pow_ultra_fast_wrapper<double, uint32_t>>, powerix::VandermondeLayout::RowMajor)->POWERIX_VANDERMONDE_DEGREES;
+BENCHMARK_TEMPLATE(BM_PowVandermonde_T, vandermonde_wrapper<powerix::VandermondeLayout::RowMajor>, powerix::VandermondeLayout::RowMajor)->POWERIX_VANDERMONDE_DEGREES;
+BENCHMARK_TEMPLATE(BM_PowVandermonde_T, vandermonde_wrapper<powerix::VandermondeLayout::ColMajor>, powerix::VandermondeLayout::ColMajor)->POWERIX_VANDERMONDE_DEGREES;
+
+// Polynomials of degree 4, 8 and 16: pow per term vs Horner vs Estrin
+#define POWERIX_POLY_SIZES Arg(1 << 10)->Arg(1 << 16)
+#define POWERIX_POLY(N) \
+    BENCHMARK_TEMPLATE(BM_PolyEval_T, (poly_pow_per_term_batch_wrapper<std_pow_wrapper<double, uint32_t>, N>), N, poly_per_term_ulp_bound<N>)->POWERIX_POLY_SIZES; \
+    BENCHMARK_TEMPLATE(BM_PolyEval_T, (poly_pow_per_term_batch_wrapper<hierarchical_pow_wrapper<double, uint32_t>, N>), N, poly_per_term_ulp_bound<N>)->POWERIX_POLY_SIZES; \
+    BENCHMARK_TEMPLATE(BM_PolyEval_T, (poly_eval_batch_wrapper<powerix::PolyScheme::Horner, N>), N, (powerix::poly_eval_ulp_bound<N, double>))->POWERIX_POLY_SIZES; \
+    BENCHMARK_TEMPLATE(BM_PolyEval_T, (poly_eval_batch_wrapper<powerix::PolyScheme::Estrin, N>), N, (powerix::poly_eval_ulp_bound<N, double>))->POWERIX_POLY_SIZES; \
+    BENCHMARK_TEMPLATE(BM_PolyLatency_T, (poly_eval_wrapper<powerix::PolyScheme::Horner, N>), N); \
+    BENCHMARK_TEMPLATE(BM_PolyLatency_T, (poly_eval_wrapper<powerix::PolyScheme::Estrin, N>), N)
+
+POWERIX_POLY(5);
+POWERIX_POLY(9);
+POWERIX_POLY(17);
+
+// Accuracy at large exponents: libm vs the plain ladder vs the double-double ladder
+BENCHMARK_TEMPLATE(BM_PowLargeExp_T, std_pow_wrapper<double, uint32_t>, libm_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowLargeExp_T, hierarchical_pow_wrapper<double, uint32_t>, ladder_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowLargeExp_T, hierarchical_dd_wrapper<double, uint32_t>, dd_ulp_bound);
+
+// Multi-core scaling of the chunked work-stealing parallel_pow
+BENCHMARK_TEMPLATE(BM_ParallelPow_T, double, uint32_t)->Apply(parallel_thread_counts)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ParallelPow_T, uint64_t, uint32_t)->Apply(parallel_thread_counts)->UseRealTime();
+
+// Concurrent cache scaling: sharded locks vs a single global lock
+BENCHMARK_TEMPLATE(BM_PowCacheHit_T, uint64_t, uint32_t, 64)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PowCacheHit_T, uint64_t, uint32_t, 1)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PowCacheHit_T, double, uint32_t, 64)->ThreadRange(1, 16)->UseRealTime();
+
+// Bounded CLOCK cache: capacity sweep under Zipf(s) with s in {0.8, 1.1}
+BENCHMARK_TEMPLATE(BM_PowBoundedCacheZipf_T, uint64_t)->ArgsProduct({{256, 4096, 16384}, {80, 110}});
+BENCHMARK_TEMPLATE(BM_PowBoundedCacheZipf_T, double)->ArgsProduct({{256, 4096, 16384}, {80, 110}});
+
+// Precomputed PowTable vs pow_cached_static_array
+BENCHMARK_TEMPLATE(BM_PowTable_T, uint64_t, 16, 16);
+BENCHMARK_TEMPLATE(BM_PowStaticArray_T, uint64_t, 16, 16);
+BENCHMARK_TEMPLATE(BM_PowTable_T, uint64_t, 65, 64);
+BENCHMARK_TEMPLATE(BM_PowStaticArray_T, uint64_t, 65, 64);
+BENCHMARK_TEMPLATE(BM_PowTable_T, double, 65, 64);
+
+// Overflowing inputs: wrapping vs checked vs saturating
+BENCHMARK_TEMPLATE(BM_PowOverflow_T, hierarchical_pow_wrapper<uint32_t, uint32_t>, uint32_t, uint32_t);
+BENCHMARK_TEMPLATE(BM_PowOverflow_T, pow_checked_wrapper<uint32_t, uint32_t>, uint32_t, uint32_t);
+BENCHMARK_TEMPLATE(BM_PowOverflow_T, pow_saturating_wrapper<uint32_t, uint32_t>, uint32_t, uint32_t);
+BENCHMARK_TEMPLATE(BM_PowOverflow_T, hierarchical_pow_wrapper<uint64_t, uint64_t>, uint64_t, uint64_t);
+BENCHMARK_TEMPLATE(BM_PowOverflow_T, pow_checked_wrapper<uint64_t, uint64_t>, uint64_t, uint64_t);
+BENCHMARK_TEMPLATE(BM_PowOverflow_T, pow_saturating_wrapper<uint64_t, uint64_t>, uint64_t, uint64_t);
+
+// Signed exponents (negative bases and exponents)
+BENCHMARK_TEMPLATE(BM_PowSigned_T, std_pow_wrapper<double, int32_t>, double, int32_t, libm_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowSigned_T, hierarchical_pow_wrapper<double, int32_t>, double, int32_t);
+BENCHMARK_TEMPLATE(BM_PowSigned_T, pow_binary_wrapper<double, int32_t>, double, int32_t);
+BENCHMARK_TEMPLATE(BM_PowSigned_T, hierarchical_dd_wrapper<double, int32_t>, double, int32_t, dd_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowSigned_T, hierarchical_pow_wrapper<int32_t, int32_t>, int32_t, int32_t);
+BENCHMARK_TEMPLATE(BM_PowSigned_T, hierarchical_pow_wrapper<int64_t, int32_t>, int64_t, int32_t);
+BENCHMARK_TEMPLATE(BM_PowSigned_T, pow_binary_wrapper<int32_t, int32_t>, int32_t, int32_t);
+BENCHMARK_TEMPLATE(BM_PowSigned_T, pow_binary_wrapper<int64_t, int64_t>, int64_t, int64_t);
+
 BENCHMARK_MAIN(); 
\ No newline at end of file
@@ -1,12 +1,21 @@
 #include <benchmark/benchmark.h>
 #include <cmath>
 #include <cstdint>
+#include <limits>
 #include <vector>
 #include <iostream>
+#include <span>
 #include <tuple>
 #include <type_traits>
 #include "../src/pow_impl.hpp"
+#include "../src/pow_approx.hpp"
+#include "../src/pow_tier.hpp"
 #include "../src/error_util.hpp"
+#include "datasets.hpp"
+
+#if POWERIX_HAS_EIGEN
+#include "../src/pow_eigen.hpp"
+#endif
 
 // Datasets for fractional exponent benchmarks
 static const std::vector<float> kFloat32BasesFrac{0.1f, 0.3f, 0.5f, 0.8f, 1.0f, 2.0f, 3.0f, 5.0f, 8.0f, 13.0f};
@@ -38,31 +47,57 @@ inline void run_dataset_frac(F&& func, const BasesT& bases) {
     benchmark::DoNotOptimize(sink);
 }
 
-// Helper function to compute error for a specific benchmark
+// Helper function to compute error for a specific benchmark, in ULP of the
+// kernel's result type against x^(2/3) with the exponent unrounded
 template<typename Func, typename BaseType>
-powerix::Error calculate_error_for_benchmark_frac(Func&& func, const std::vector<BaseType>& bases) {
+powerix::Error calculate_error_for_benchmark_frac(Func&& func, const std::vector<BaseType>& bases,
+                                                  double (*ulp_bound)(double), powerix::UlpContract& contract) {
     double max_abs_err = 0.0;
     double max_rel_err = 0.0;
     
     for (auto base : bases) {
         double d_base = static_cast<double>(base);
-        double reference = std::pow(d_base, kFracExp);
-        double test_value = static_cast<double>(func(base, kFracExp));
+        long double reference = powerix::reference_pow_rational(d_base, 2, 3);
         
-        auto error = powerix::compute_error(reference, test_value);
+        auto error = powerix::compute_error(reference, func(base, kFracExp));
         max_abs_err = std::max(max_abs_err, error.abs_err);
         max_rel_err = std::max(max_rel_err, error.rel_err);
+        contract.add(d_base, error.ulp_err, ulp_bound(d_base));
     }
     
-    return {max_abs_err, max_rel_err};
+    return {max_abs_err, max_rel_err, contract.max_ulp};
 }
 
-#define ADD_METRICS_AND_NS_PER_POW_FRAC(state, func, bases) \
-    auto error = calculate_error_for_benchmark_frac(func, bases); \
-    state.counters["MaxRelErr"] = error.rel_err;
+#define ADD_METRICS_AND_NS_PER_POW_FRAC(state, func, bases, ulp_bound) \
+    powerix::UlpContract contract; \
+    auto error = calculate_error_for_benchmark_frac(func, bases, ulp_bound, contract); \
+    state.counters["MaxRelErr"] = error.rel_err; \
+    state.counters["MaxUlp"] = error.ulp_err; \
+    if (contract.violated) state.SkipWithError(contract.message().c_str());
+
+// libm pow is held to 1 ULP for the arguments it is given. Rounding the exact
+// exponent to ExpType first moves the result by a relative |delta * log(x)|,
+// and rounding the base to a narrower ResultType (pow_c_raw's powf path)
+// by up to |exponent| ULP.
+template <typename BaseType, typename ExpType, typename ResultType>
+double libm_ulp_bound(double x, long double exact_exp) {
+    const long double delta = std::fabs(static_cast<long double>(static_cast<ExpType>(exact_exp)) - exact_exp);
+    const long double shift = delta * std::fabs(std::log(static_cast<long double>(x))) * 2 / std::numeric_limits<ResultType>::epsilon();
+    double bound = powerix::kLibmPowUlpBound + static_cast<double>(shift);
+    if constexpr (sizeof(ResultType) < sizeof(BaseType)) {
+        bound += std::fabs(static_cast<double>(exact_exp));
+    }
+    return bound;
+}
 
-// Generic benchmark template
 template <auto PowFunc, typename BaseType, typename ExpType>
+double frac_libm_ulp_bound(double x) {
+    using ResultType = decltype(PowFunc(BaseType{}, ExpType{}));
+    return libm_ulp_bound<BaseType, ExpType, ResultType>(x, 2.0L / 3);
+}
+
+// Generic benchmark template; libm-backed kernels default to the libm contract
+template <auto PowFunc, typename BaseType, typename ExpType, double (*UlpBound)(double) = frac_libm_ulp_bound<PowFunc, BaseType, ExpType>>
 void BM_PowGeneric_Frac_T(benchmark::State& state) {
     auto func = [](BaseType base, double exp) {
         return PowFunc(base, static_cast<ExpType>(exp));
@@ -72,7 +107,7 @@ void BM_PowGeneric_Frac_T(benchmark::State& state) {
     for (auto _ : state) {
         run_dataset_frac(func, bases);
     }
-    ADD_METRICS_AND_NS_PER_POW_FRAC(state, func, bases);
+    ADD_METRICS_AND_NS_PER_POW_FRAC(state, func, bases, UlpBound);
 }
 
 // Wrapper functions for different pow implementations
@@ -101,6 +136,233 @@ inline auto series_pow_wrapper(BaseType base, [[maybe_unused]] ExpType exp) {
     return powerix::pow_2_3_series(base);
 }
 
+template<typename BaseType, typename ExpType>
+inline auto poly_pow_wrapper(BaseType base, [[maybe_unused]] ExpType exp) {
+    return powerix::pow_2_3_poly(base);
+}
+
+// Latency mode: each result feeds the next base through an opaque zero, so
+// calls cannot overlap (see BM_PowLatency_T in benchmark_pow.cpp); the batch
+// benchmarks below are the matching throughput mode
+template <auto PowFunc, typename BaseType, typename ExpType>
+void BM_PowLatency_Frac_T(benchmark::State& state) {
+    const auto& bases = get_bases_frac<BaseType>();
+    const ExpType exp = static_cast<ExpType>(kFracExp);
+    BaseType zero = 0;
+    benchmark::DoNotOptimize(zero);
+    BaseType carry = 0;
+
+    for (auto _ : state) {
+        for (auto base : bases) {
+            carry = static_cast<BaseType>(PowFunc(base + carry, exp) * zero);
+        }
+    }
+    benchmark::DoNotOptimize(carry);
+    state.SetItemsProcessed(state.iterations() * bases.size());
+}
+
+// Batch benchmark over arrays of state.range(0) elements cycling the base dataset
+template <auto BatchFunc, typename BaseType, double (*UlpBound)(double)>
+void BM_PowBatch_Frac_T(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto& pattern = get_bases_frac<BaseType>();
+    std::vector<BaseType> bases(n);
+    std::vector<BaseType> out(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        bases[i] = pattern[i % pattern.size()];
+    }
+
+    for (auto _ : state) {
+        BatchFunc(std::span<const BaseType>(bases), std::span<BaseType>(out));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    auto func = [&](BaseType base, double) {
+        BaseType value = base;
+        BatchFunc(std::span<const BaseType>(&base, 1), std::span<BaseType>(&value, 1));
+        return value;
+    };
+    ADD_METRICS_AND_NS_PER_POW_FRAC(state, func, pattern, UlpBound);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n * sizeof(BaseType)));
+}
+
+#if POWERIX_HAS_EIGEN
+template <powerix::EigenPowMethod Method, typename BaseType>
+inline void eigen_batch_wrapper(std::span<const BaseType> bases, std::span<BaseType> out) {
+    powerix::pow_2_3_eigen<Method>(bases, out);
+}
+#endif
+
+// Production-like bases from datasets.hpp (the exponent column is unused):
+// state.range(0) is the distribution, state.range(1) the number of bases
+template <auto PowFunc, typename BaseType>
+void BM_PowDistribution_Frac_T(benchmark::State& state) {
+    const auto distribution = static_cast<datasets::Distribution>(state.range(0));
+    const auto data = datasets::make_dataset<BaseType, double>(distribution, static_cast<std::size_t>(state.range(1)));
+    if (data.empty()) {
+        state.SkipWithError("no trace: set POWERIX_TRACE to a file of 'base exp' lines");
+        return;
+    }
+    const auto exp = static_cast<BaseType>(kFracExp);
+    std::vector<decltype(PowFunc(BaseType{}, BaseType{}))> out(data.bases.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            out[i] = PowFunc(data.bases[i], exp);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetLabel(datasets::distribution_name(distribution));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(out.size()));
+}
+
+// Element-by-element loop over a scalar kernel, for comparison with the batch kernels
+template <auto ScalarFunc, typename BaseType>
+inline void scalar_loop_batch_wrapper(std::span<const BaseType> bases, std::span<BaseType> out) {
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = static_cast<BaseType>(ScalarFunc(bases[i], static_cast<BaseType>(kFracExp)));
+    }
+}
+
+template <typename BaseType>
+inline void poly_batch_wrapper(std::span<const BaseType> bases, std::span<BaseType> out) {
+    powerix::pow_2_3_batch(bases, out);
+}
+
+// Approximate kernels: the contract is the relative error bound, which is at
+// most 2 / epsilon ULP per unit of relative error
+template <int Refine, typename BaseType, typename ExpType>
+inline auto approx_pow_wrapper(BaseType base, ExpType exp) {
+    return powerix::pow_approx<Refine>(base, static_cast<BaseType>(exp));
+}
+
+template <int Refine, typename BaseType>
+inline void approx_batch_wrapper(std::span<const BaseType> bases, std::span<BaseType> out) {
+    powerix::pow_approx_batch<Refine>(bases, static_cast<BaseType>(kFracExp), out);
+}
+
+template <typename BaseType, int Refine>
+double approx_ulp_bound(double x) {
+    return 2 * powerix::pow_approx_rel_error_bound<BaseType, Refine>(x, kFracExp) / std::numeric_limits<BaseType>::epsilon();
+}
+
+// Accuracy tiers: the front end's pick for x^(2/3), held to the bound it
+// guarantees; the label names the kernel
+template <powerix::Accuracy Tier, typename BaseType, typename ExpType>
+inline auto tier_pow_wrapper(BaseType base, [[maybe_unused]] ExpType exp) {
+    return powerix::pow<Tier, 2, 3>(base);
+}
+
+template <powerix::Accuracy Tier, typename BaseType>
+inline void tier_batch_wrapper(std::span<const BaseType> bases, std::span<BaseType> out) {
+    powerix::pow_batch<Tier, 2, 3>(bases, out);
+}
+
+template <powerix::Accuracy Tier, typename BaseType>
+double tier_ulp_bound(double) {
+    return powerix::pow_tier_choice<Tier, BaseType, 2, 3>().max_ulp;
+}
+
+template <powerix::Accuracy Tier, typename BaseType>
+void BM_PowTier_Frac_T(benchmark::State& state) {
+    BM_PowBatch_Frac_T<tier_batch_wrapper<Tier, BaseType>, BaseType, tier_ulp_bound<Tier, BaseType>>(state);
+    state.SetLabel(powerix::tier_kernel_name(powerix::pow_tier_choice<Tier, BaseType, 2, 3>().kernel));
+}
+
+// Accuracy tiers near overflow: x^(5/3) over bases whose results fill the top
+// half-binade of T, up to the tier's bound below the largest finite value
+template <powerix::Accuracy Tier, typename BaseType>
+void BM_PowTierTop_T(benchmark::State& state) {
+    constexpr powerix::TierChoice choice = powerix::pow_tier_choice<Tier, BaseType, 5, 3>();
+    constexpr double top = std::numeric_limits<BaseType>::max_exponent;
+    const double margin = std::log2(1 + choice.max_ulp * std::numeric_limits<BaseType>::epsilon() / 2);
+    const auto n = static_cast<std::size_t>(state.range(0));
+    std::vector<BaseType> bases(n);
+    std::vector<BaseType> out(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double log2_result = top - 1 + (1 - margin) * (static_cast<double>(i) + 0.5) / static_cast<double>(n);
+        bases[i] = static_cast<BaseType>(std::exp2(log2_result * 3 / 5));
+    }
+
+    for (auto _ : state) {
+        powerix::pow_batch<Tier, 5, 3>(std::span<const BaseType>(bases), std::span<BaseType>(out));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    powerix::UlpContract contract;
+    for (std::size_t i = 0; i < n; ++i) {
+        const long double reference = powerix::reference_pow_rational(bases[i], 5, 3);
+        contract.add(static_cast<double>(bases[i]), powerix::compute_error(reference, out[i]).ulp_err, choice.max_ulp);
+    }
+    state.counters["MaxUlp"] = contract.max_ulp;
+    if (contract.violated) state.SkipWithError(contract.message().c_str());
+    state.SetLabel(powerix::tier_kernel_name(choice.kernel));
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+
+// Rational exponent sweep: pow_rational<P, Q> with each strategy against std::pow
+template<typename Func, typename BaseType>
+void add_rational_metrics(benchmark::State& state, Func&& func, const std::vector<BaseType>& bases, int p, int q,
+                          double (*ulp_bound)(double)) {
+    powerix::UlpContract contract;
+    double max_rel_err = 0.0;
+
+    for (auto base : bases) {
+        long double reference = powerix::reference_pow_rational(static_cast<double>(base), p, q);
+        auto error = powerix::compute_error(reference, func(base));
+        max_rel_err = std::max(max_rel_err, error.rel_err);
+        contract.add(static_cast<double>(base), error.ulp_err, ulp_bound(static_cast<double>(base)));
+    }
+
+    state.counters["MaxRelErr"] = max_rel_err;
+    state.counters["MaxUlp"] = contract.max_ulp;
+    if (contract.violated) state.SkipWithError(contract.message().c_str());
+}
+
+template <int P, int Q, powerix::RationalStrategy Strategy, typename BaseType>
+void BM_PowRational_T(benchmark::State& state) {
+    auto func = [](BaseType base) {
+        return powerix::pow_rational<P, Q, Strategy>(base);
+    };
+    const auto& bases = get_bases_frac<BaseType>();
+
+    for (auto _ : state) {
+        volatile double sink = 0.0;
+        for (auto base : bases) {
+            sink = sink + func(base);
+        }
+        benchmark::DoNotOptimize(sink);
+    }
+    add_rational_metrics(state, func, bases, P, Q, powerix::pow_rational_ulp_bound<P, Q, Strategy>);
+}
+
+template <int P, int Q, typename BaseType>
+double rational_libm_ulp_bound(double x) {
+    return libm_ulp_bound<BaseType, BaseType, BaseType>(x, static_cast<long double>(P) / Q);
+}
+
+template <int P, int Q, typename BaseType>
+void BM_PowRationalStd_T(benchmark::State& state) {
+    constexpr BaseType exponent = static_cast<BaseType>(static_cast<double>(P) / Q);
+    auto func = [](BaseType base) {
+        return std::pow(base, exponent);
+    };
+    const auto& bases = get_bases_frac<BaseType>();
+
+    for (auto _ : state) {
+        volatile double sink = 0.0;
+        for (auto base : bases) {
+            sink = sink + func(base);
+        }
+        benchmark::DoNotOptimize(sink);
+    }
+    add_rational_metrics(state, func, bases, P, Q, rational_libm_ulp_bound<P, Q, BaseType>);
+}
+
 // Register all benchmarks
 // Standard pow (reference)
 BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, std_pow_wrapper<float, float>, float, float);
@@ -115,21 +377,117 @@ BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, c_raw_pow_wrapper<double, float>, doubl
 BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, c_raw_pow_wrapper<double, double>, double, double);
 
 // Cube root version
-BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, cbrt_pow_wrapper<float, float>, float, float);
-BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, cbrt_pow_wrapper<float, double>, float, double);
-BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, cbrt_pow_wrapper<double, float>, double, float);
-BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, cbrt_pow_wrapper<double, double>, double, double);
+BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, cbrt_pow_wrapper<float, float>, float, float, powerix::pow_2_3_cbrt_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, cbrt_pow_wrapper<float, double>, float, double, powerix::pow_2_3_cbrt_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, cbrt_pow_wrapper<double, float>, double, float, powerix::pow_2_3_cbrt_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, cbrt_pow_wrapper<double, double>, double, double, powerix::pow_2_3_cbrt_ulp_bound);
 
 // Exponential and logarithmic version
-BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, exp_log_pow_wrapper<float, float>, float, float);
-BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, exp_log_pow_wrapper<float, double>, float, double);
-BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, exp_log_pow_wrapper<double, float>, double, float);
-BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, exp_log_pow_wrapper<double, double>, double, double);
+BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, exp_log_pow_wrapper<float, float>, float, float, powerix::pow_2_3_exp_log_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, exp_log_pow_wrapper<float, double>, float, double, powerix::pow_2_3_exp_log_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, exp_log_pow_wrapper<double, float>, double, float, powerix::pow_2_3_exp_log_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, exp_log_pow_wrapper<double, double>, double, double, powerix::pow_2_3_exp_log_ulp_bound);
 
 // Binomial series version
-BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, series_pow_wrapper<float, float>, float, float);
-BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, series_pow_wrapper<float, double>, float, double);
-BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, series_pow_wrapper<double, float>, double, float);
-BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, series_pow_wrapper<double, double>, double, double);
+BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, series_pow_wrapper<float, float>, float, float, powerix::pow_2_3_series_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, series_pow_wrapper<float, double>, float, double, powerix::pow_2_3_series_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, series_pow_wrapper<double, float>, double, float, powerix::pow_2_3_series_ulp_bound);
+BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, series_pow_wrapper<double, double>, double, double, powerix::pow_2_3_series_ulp_bound);
+
+// Polynomial log/exp version
+BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, poly_pow_wrapper<float, float>, float, float, powerix::pow_2_3_poly_ulp_bound<>);
+BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, poly_pow_wrapper<double, double>, double, double, powerix::pow_2_3_poly_ulp_bound<>);
+
+// Dependent-chain latency of each kernel
+BENCHMARK_TEMPLATE(BM_PowLatency_Frac_T, std_pow_wrapper<float, float>, float, float);
+BENCHMARK_TEMPLATE(BM_PowLatency_Frac_T, std_pow_wrapper<double, double>, double, double);
+BENCHMARK_TEMPLATE(BM_PowLatency_Frac_T, cbrt_pow_wrapper<float, float>, float, float);
+BENCHMARK_TEMPLATE(BM_PowLatency_Frac_T, cbrt_pow_wrapper<double, double>, double, double);
+BENCHMARK_TEMPLATE(BM_PowLatency_Frac_T, exp_log_pow_wrapper<float, float>, float, float);
+BENCHMARK_TEMPLATE(BM_PowLatency_Frac_T, exp_log_pow_wrapper<double, double>, double, double);
+BENCHMARK_TEMPLATE(BM_PowLatency_Frac_T, poly_pow_wrapper<float, float>, float, float);
+BENCHMARK_TEMPLATE(BM_PowLatency_Frac_T, poly_pow_wrapper<double, double>, double, double);
+
+// Batched kernels over arrays
+#define POWERIX_FRAC_BATCH_SIZES Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 22)
+
+BENCHMARK_TEMPLATE(BM_PowBatch_Frac_T, scalar_loop_batch_wrapper<std_pow_wrapper<float, float>, float>, float, frac_libm_ulp_bound<std_pow_wrapper<float, float>, float, float>)->POWERIX_FRAC_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatch_Frac_T, scalar_loop_batch_wrapper<std_pow_wrapper<double, double>, double>, double, frac_libm_ulp_bound<std_pow_wrapper<double, double>, double, double>)->POWERIX_FRAC_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatch_Frac_T, scalar_loop_batch_wrapper<exp_log_pow_wrapper<float, float>, float>, float, powerix::pow_2_3_exp_log_ulp_bound)->POWERIX_FRAC_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatch_Frac_T, scalar_loop_batch_wrapper<exp_log_pow_wrapper<double, double>, double>, double, powerix::pow_2_3_exp_log_ulp_bound)->POWERIX_FRAC_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatch_Frac_T, scalar_loop_batch_wrapper<cbrt_pow_wrapper<float, float>, float>, float, powerix::pow_2_3_cbrt_ulp_bound)->POWERIX_FRAC_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatch_Frac_T, scalar_loop_batch_wrapper<cbrt_pow_wrapper<double, double>, double>, double, powerix::pow_2_3_cbrt_ulp_bound)->POWERIX_FRAC_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatch_Frac_T, poly_batch_wrapper<float>, float, powerix::pow_2_3_poly_ulp_bound<>)->POWERIX_FRAC_BATCH_SIZES;
+BENCHMARK_TEMPLATE(BM_PowBatch_Frac_T, poly_batch_wrapper<double>, double, powerix::pow_2_3_poly_ulp_bound<>)->POWERIX_FRAC_BATCH_SIZES;
+
+// Approximate pow at each refinement level: MaxRelErr next to the throughput
+#define POWERIX_APPROX(Refine, BaseType) \
+    BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, approx_pow_wrapper<Refine, BaseType, BaseType>, BaseType, BaseType, \
+                       approx_ulp_bound<BaseType, Refine>); \
+    BENCHMARK_TEMPLATE(BM_PowBatch_Frac_T, approx_batch_wrapper<Refine, BaseType>, BaseType, \
+                       approx_ulp_bound<BaseType, Refine>)->POWERIX_FRAC_BATCH_SIZES
+
+POWERIX_APPROX(0, float);
+POWERIX_APPROX(1, float);
+POWERIX_APPROX(2, float);
+POWERIX_APPROX(3, float);
+POWERIX_APPROX(0, double);
+POWERIX_APPROX(1, double);
+POWERIX_APPROX(2, double);
+POWERIX_APPROX(3, double);
+
+// Accuracy tiers: scalar and batch x^(2/3) at each tier, and x^(5/3) next to overflow
+#define POWERIX_TIER(Tier, BaseType) \
+    BENCHMARK_TEMPLATE(BM_PowGeneric_Frac_T, tier_pow_wrapper<powerix::Accuracy::Tier, BaseType, BaseType>, BaseType, BaseType, \
+                       tier_ulp_bound<powerix::Accuracy::Tier, BaseType>); \
+    BENCHMARK_TEMPLATE(BM_PowTier_Frac_T, powerix::Accuracy::Tier, BaseType)->POWERIX_FRAC_BATCH_SIZES; \
+    BENCHMARK_TEMPLATE(BM_PowTierTop_T, powerix::Accuracy::Tier, BaseType)->Arg(1 << 10)
+
+POWERIX_TIER(Fast, float);
+POWERIX_TIER(Balanced, float);
+POWERIX_TIER(Exact, float);
+POWERIX_TIER(Fast, double);
+POWERIX_TIER(Balanced, double);
+POWERIX_TIER(Exact, double);
+
+#if POWERIX_HAS_EIGEN
+// Eigen array kernels against the scalar loops and poly batches above
+#define POWERIX_EIGEN_BATCH(Method, BaseType) \
+    BENCHMARK_TEMPLATE(BM_PowBatch_Frac_T, eigen_batch_wrapper<powerix::EigenPowMethod::Method, BaseType>, BaseType, \
+                       powerix::pow_2_3_eigen_ulp_bound<powerix::EigenPowMethod::Method, BaseType>)->POWERIX_FRAC_BATCH_SIZES
+
+POWERIX_EIGEN_BATCH(Pow, float);
+POWERIX_EIGEN_BATCH(Pow, double);
+POWERIX_EIGEN_BATCH(ExpLog, float);
+POWERIX_EIGEN_BATCH(ExpLog, double);
+POWERIX_EIGEN_BATCH(CbrtSquare, float);
+POWERIX_EIGEN_BATCH(CbrtSquare, double);
+#endif
+
+// Distribution datasets: uniform, Zipf, log-uniform and trace replay at 1K to 4M bases
+BENCHMARK_TEMPLATE(BM_PowDistribution_Frac_T, std_pow_wrapper<double, double>, double)->POWERIX_DATASET_ARGS;
+BENCHMARK_TEMPLATE(BM_PowDistribution_Frac_T, cbrt_pow_wrapper<double, double>, double)->POWERIX_DATASET_ARGS;
+BENCHMARK_TEMPLATE(BM_PowDistribution_Frac_T, exp_log_pow_wrapper<double, double>, double)->POWERIX_DATASET_ARGS;
+BENCHMARK_TEMPLATE(BM_PowDistribution_Frac_T, poly_pow_wrapper<double, double>, double)->POWERIX_DATASET_ARGS;
+BENCHMARK_TEMPLATE(BM_PowDistribution_Frac_T, poly_pow_wrapper<float, float>, float)->POWERIX_DATASET_ARGS;
+
+// Rational exponent sweep: every strategy for each exponent, std::pow as reference
+#define POWERIX_RATIONAL_SWEEP(P, Q, BaseType) \
+    BENCHMARK_TEMPLATE(BM_PowRationalStd_T, P, Q, BaseType); \
+    BENCHMARK_TEMPLATE(BM_PowRational_T, P, Q, powerix::RationalStrategy::Root, BaseType); \
+    BENCHMARK_TEMPLATE(BM_PowRational_T, P, Q, powerix::RationalStrategy::ExpLog, BaseType); \
+    BENCHMARK_TEMPLATE(BM_PowRational_T, P, Q, powerix::RationalStrategy::Series, BaseType); \
+    BENCHMARK_TEMPLATE(BM_PowRational_T, P, Q, powerix::RationalStrategy::Poly, BaseType)
+
+POWERIX_RATIONAL_SWEEP(1, 3, double);
+POWERIX_RATIONAL_SWEEP(2, 3, double);
+POWERIX_RATIONAL_SWEEP(4, 3, double);
+POWERIX_RATIONAL_SWEEP(5, 3, double);
+POWERIX_RATIONAL_SWEEP(3, 2, double);
+POWERIX_RATIONAL_SWEEP(-1, 2, double);
+POWERIX_RATIONAL_SWEEP(1, 3, float);
+POWERIX_RATIONAL_SWEEP(4, 3, float);
+POWERIX_RATIONAL_SWEEP(3, 2, float);
+POWERIX_RATIONAL_SWEEP(-1, 2, float);
 
 BENCHMARK_MAIN(); 
\ No newline at end of file
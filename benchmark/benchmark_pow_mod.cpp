@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+#include "../src/pow_mod.hpp"
+
+// Moduli: largest 32/64-bit primes (odd, Montgomery path) and an even modulus (naive fallback)
+constexpr uint32_t kPrime32 = 4294967291u;
+constexpr uint64_t kPrime64 = 18446744073709551557ull;
+constexpr uint64_t kEven64 = (1ull << 62) + 2;
+
+// Full-width random bases and exponents, shared by all benchmarks of a type
+template <typename UInt>
+const std::vector<UInt>& get_mod_data(uint64_t seed) {
+    static std::vector<UInt> data[2];
+    auto& values = data[seed & 1];
+    if (values.empty()) {
+        std::mt19937_64 rng(seed);
+        values.resize(1 << 10);
+        for (auto& v : values) {
+            v = static_cast<UInt>(rng());
+        }
+    }
+    return values;
+}
+
+template <typename UInt>
+UInt pow_mod_wrapper(UInt base, UInt exp, UInt mod) {
+    return powerix::pow_mod(base, exp, mod);
+}
+
+template <typename UInt>
+UInt pow_mod_naive_wrapper(UInt base, UInt exp, UInt mod) {
+    return powerix::pow_mod_naive(base, exp, mod);
+}
+
+// Cross-check against the naive ladder; reported as a counter, and any
+// mismatch fails the row like a violated UlpContract elsewhere
+template <typename UInt>
+double count_mismatches(UInt mod) {
+    const auto& bases = get_mod_data<UInt>(0);
+    const auto& exps = get_mod_data<UInt>(1);
+    double mismatches = 0;
+    for (std::size_t i = 0; i < bases.size(); ++i) {
+        mismatches += powerix::pow_mod(bases[i], exps[i], mod) != powerix::pow_mod_naive(bases[i], exps[i], mod);
+    }
+    return mismatches;
+}
+
+// Scalar: one full-width (base, exp) pair per call; state.range(0) selects the modulus
+template <auto PowModFunc, typename UInt>
+void BM_PowMod_T(benchmark::State& state) {
+    const UInt mod = static_cast<UInt>(state.range(0) == 0 ? (sizeof(UInt) == 4 ? kPrime32 : kPrime64) : kEven64);
+    const auto& bases = get_mod_data<UInt>(0);
+    const auto& exps = get_mod_data<UInt>(1);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < bases.size(); ++i) {
+            benchmark::DoNotOptimize(PowModFunc(bases[i], exps[i], mod));
+        }
+    }
+    state.SetLabel((mod & 1u) ? "odd modulus" : "even modulus");
+    const double mismatches = count_mismatches(mod);
+    state.counters["Mismatches"] = mismatches;
+    if (mismatches != 0) state.SkipWithError("pow_mod disagrees with pow_mod_naive");
+    state.SetItemsProcessed(state.iterations() * bases.size());
+}
+
+// Batched: fixed odd modulus, Montgomery constants computed once per call
+template <typename UInt>
+void BM_PowModBatch_T(benchmark::State& state) {
+    const UInt mod = static_cast<UInt>(sizeof(UInt) == 4 ? kPrime32 : kPrime64);
+    const auto& bases = get_mod_data<UInt>(0);
+    const auto& exps = get_mod_data<UInt>(1);
+    std::vector<UInt> out(bases.size());
+
+    for (auto _ : state) {
+        powerix::pow_mod_batch(std::span<const UInt>(bases), std::span<const UInt>(exps), mod, std::span<UInt>(out));
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    double mismatches = 0;
+    for (std::size_t i = 0; i < bases.size(); ++i) {
+        mismatches += out[i] != powerix::pow_mod_naive(bases[i], exps[i], mod);
+    }
+    state.counters["Mismatches"] = mismatches;
+    if (mismatches != 0) state.SkipWithError("pow_mod_batch disagrees with pow_mod_naive");
+    state.SetItemsProcessed(state.iterations() * bases.size());
+}
+
+// Register all benchmarks
+BENCHMARK_TEMPLATE(BM_PowMod_T, pow_mod_naive_wrapper<uint32_t>, uint32_t)->Arg(0);
+BENCHMARK_TEMPLATE(BM_PowMod_T, pow_mod_wrapper<uint32_t>, uint32_t)->Arg(0);
+BENCHMARK_TEMPLATE(BM_PowMod_T, pow_mod_naive_wrapper<uint64_t>, uint64_t)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_PowMod_T, pow_mod_wrapper<uint64_t>, uint64_t)->Arg(0)->Arg(1);
+
+BENCHMARK_TEMPLATE(BM_PowModBatch_T, uint32_t);
+BENCHMARK_TEMPLATE(BM_PowModBatch_T, uint64_t);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Input generators for the benchmark suites. The fixed datasets in the
+// benchmark files are a handful of values: fully cache-resident and perfectly
+// branch-predictable. These produce (base, exp) arrays of any length from a
+// distribution, so kernels with data-dependent branches (pow_ultra_fast's
+// switch, the cache probes) and memory behaviour are measured under realistic
+// conditions. Sizes are element counts; a double/uint32 pair is 12 bytes, so
+// 1K elements fit in L1 and 4M are well beyond a typical LLC.
+
+namespace datasets {
+
+enum class Distribution {
+    Uniform,     // bases and exps uniform over their range
+    Zipf,        // (base, exp) keys ranked by popularity, P(rank) ~ 1 / rank^s
+    LogUniform,  // bases and exps uniform in log space: as many small as large
+    Trace,       // replay of a "base exp" per line file named by POWERIX_TRACE
+};
+
+inline const char* distribution_name(Distribution d) {
+    switch (d) {
+        case Distribution::Uniform: return "uniform";
+        case Distribution::Zipf: return "zipf";
+        case Distribution::LogUniform: return "log-uniform";
+        case Distribution::Trace: return "trace";
+    }
+    return "?";
+}
+
+// Ranges: integer bases stay below 4096 and exps below 64 (the wrapped results
+// of unsigned types are fine for timing); floating bases in [1/8, 8) keep every
+// integer power below 64 a normal double, so no subnormal stalls skew timings.
+inline constexpr uint32_t kMaxIntBase = 4096;
+inline constexpr uint32_t kMaxExp = 64;
+inline constexpr double kMinFloatBase = 0.125;
+inline constexpr double kMaxFloatBase = 8.0;
+inline constexpr double kMaxFloatExp = 8.0;
+
+// Zipf key ranks over [0, keys), with the ranks packed as base * kMaxExp + exp
+inline std::vector<uint32_t> zipf_ranks(uint32_t keys, double s, std::size_t n, uint64_t seed) {
+    std::vector<double> cdf(keys);
+    double total = 0.0;
+    for (uint32_t rank = 0; rank < keys; ++rank) {
+        total += 1.0 / std::pow(static_cast<double>(rank + 1), s);
+        cdf[rank] = total;
+    }
+
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> uniform(0.0, total);
+    std::vector<uint32_t> ranks(n);
+    for (auto& rank : ranks) {
+        rank = static_cast<uint32_t>(std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin());
+    }
+    return ranks;
+}
+
+// Trace lines are "base exp"; blank lines and lines starting with '#' are skipped
+inline std::vector<std::pair<double, double>> load_trace(const std::string& path) {
+    std::vector<std::pair<double, double>> trace;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream fields(line);
+        double base = 0.0;
+        double exp = 0.0;
+        if (fields >> base >> exp) {
+            trace.emplace_back(base, exp);
+        }
+    }
+    return trace;
+}
+
+inline const std::vector<std::pair<double, double>>& get_trace() {
+    static const auto trace = [] {
+        const char* path = std::getenv("POWERIX_TRACE");
+        return path ? load_trace(path) : std::vector<std::pair<double, double>>{};
+    }();
+    return trace;
+}
+
+template <typename BaseType, typename ExpType>
+struct PowDataset {
+    std::vector<BaseType> bases;
+    std::vector<ExpType> exps;
+
+    bool empty() const { return bases.empty(); }
+    std::size_t bytes() const { return bases.size() * sizeof(BaseType) + exps.size() * sizeof(ExpType); }
+};
+
+// n (base, exp) pairs drawn from d; Trace cycles the file to n entries and is
+// empty when POWERIX_TRACE is unset or unreadable
+template <typename BaseType, typename ExpType>
+PowDataset<BaseType, ExpType> make_dataset(Distribution d, std::size_t n, uint64_t seed = 42) {
+    PowDataset<BaseType, ExpType> data;
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    // u in [0, 1) mapped onto the base / exp range, linearly or in log space
+    auto base_of = [](double u, bool log_space) {
+        if constexpr (std::is_integral_v<BaseType>) {
+            return static_cast<BaseType>(log_space ? std::exp2(u * std::log2(static_cast<double>(kMaxIntBase))) : u * kMaxIntBase);
+        } else {
+            return static_cast<BaseType>(log_space ? kMinFloatBase * std::pow(kMaxFloatBase / kMinFloatBase, u)
+                                                   : kMinFloatBase + u * (kMaxFloatBase - kMinFloatBase));
+        }
+    };
+    auto exp_of = [](double u, bool log_space) {
+        const double max = std::is_integral_v<ExpType> ? static_cast<double>(kMaxExp) : kMaxFloatExp;
+        return static_cast<ExpType>(log_space ? std::exp2(u * std::log2(max)) : u * max);
+    };
+
+    switch (d) {
+        case Distribution::Uniform:
+        case Distribution::LogUniform: {
+            const bool log_space = d == Distribution::LogUniform;
+            for (std::size_t i = 0; i < n; ++i) {
+                data.bases.push_back(base_of(unit(rng), log_space));
+                data.exps.push_back(exp_of(unit(rng), log_space));
+            }
+            break;
+        }
+        case Distribution::Zipf: {
+            // 64K keys with s = 1.1: a few hundred keys take half the lookups
+            constexpr uint32_t kKeys = 1u << 16;
+            for (uint32_t rank : zipf_ranks(kKeys, 1.1, n, seed)) {
+                const uint32_t b = rank / kMaxExp;
+                if constexpr (std::is_integral_v<BaseType>) {
+                    data.bases.push_back(static_cast<BaseType>(b + 2));
+                } else {
+                    data.bases.push_back(static_cast<BaseType>(1.0 + b / 1024.0));
+                }
+                data.exps.push_back(static_cast<ExpType>(rank % kMaxExp));
+            }
+            break;
+        }
+        case Distribution::Trace: {
+            const auto& trace = get_trace();
+            if (trace.empty()) break;
+            for (std::size_t i = 0; i < n; ++i) {
+                const auto& [base, exp] = trace[i % trace.size()];
+                data.bases.push_back(static_cast<BaseType>(base));
+                data.exps.push_back(static_cast<ExpType>(exp));
+            }
+            break;
+        }
+    }
+    return data;
+}
+
+} // namespace datasets
+
+// Benchmark Args (distribution, elements): every distribution at 1K (L1), 16K (L2),
+// 256K (LLC-sized) and 4M (beyond LLC) elements
+#define POWERIX_DATASET_ARGS ArgsProduct({{0, 1, 2, 3}, {1 << 10, 1 << 14, 1 << 18, 1 << 22}})
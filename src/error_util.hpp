@@ -1,14 +1,22 @@
 #pragma once
 
+#include <algorithm>
+#include <bit>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <type_traits>
 #include <utility>
 
 namespace powerix {
 
-// Error structure for absolute and relative error
+// Error structure for absolute, relative and ULP error
 struct Error {
     double abs_err;  // Absolute error
     double rel_err;  // Relative error
+    double ulp_err = 0.0;  // Error in units in the last place of the result type
 };
 
 // Compute absolute and relative error between reference and value
@@ -18,4 +26,120 @@ inline Error compute_error(double reference, double value) {
     return {abs_err, rel_err};
 }
 
+// Number of representable values between a and b (0 when equal, counting
+// +0 and -0 as equal). Bit patterns are mapped to a monotonic integer line.
+template <typename T>
+inline uint64_t ulp_distance(T a, T b) requires std::is_floating_point_v<T> && (sizeof(T) <= 8) {
+    using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    using Signed = std::make_signed_t<Bits>;
+    constexpr Bits sign = Bits(1) << (sizeof(T) * 8 - 1);
+    auto ordered = [](T x) {
+        const Bits bits = std::bit_cast<Bits>(x);
+        return static_cast<int64_t>((bits & sign) ? -static_cast<Signed>(bits & ~sign) : static_cast<Signed>(bits));
+    };
+    const int64_t ia = ordered(a);
+    const int64_t ib = ordered(b);
+    return ia > ib ? static_cast<uint64_t>(ia - ib) : static_cast<uint64_t>(ib - ia);
+}
+
+// Error of value in units in the last place of T at the exact result, given a
+// reference computed in higher precision. Values that agree on NaN, or on an
+// infinity the reference also rounds to, count as 0; a NaN/inf mismatch is inf.
+template <typename T>
+inline double ulp_error(long double reference, T value) requires std::is_floating_point_v<T> {
+    const T rounded = static_cast<T>(reference);
+    if (std::isnan(reference) || std::isnan(value)) {
+        return (std::isnan(reference) && std::isnan(value)) ? 0.0 : std::numeric_limits<double>::infinity();
+    }
+    if (std::isinf(rounded) || std::isinf(value)) {
+        return rounded == value ? 0.0 : std::numeric_limits<double>::infinity();
+    }
+    // ulp of T at the reference, with the subnormal spacing as the floor
+    const int exponent = reference == 0.0L ? std::numeric_limits<T>::min_exponent - 1 : std::ilogb(reference);
+    const int ulp_exponent = std::max(exponent, std::numeric_limits<T>::min_exponent - 1) - (std::numeric_limits<T>::digits - 1);
+    return static_cast<double>(std::fabs(static_cast<long double>(value) - reference) / std::ldexp(1.0L, ulp_exponent));
+}
+
+// Error of a kernel result of type T against a higher-precision reference.
+// Integer results count the distance in integer steps, and only when the
+// reference is representable (wrapped overflows have no ULP meaning).
+template <typename T>
+inline Error compute_error(long double reference, T value) requires std::is_arithmetic_v<T> {
+    Error error = compute_error(static_cast<double>(reference), static_cast<double>(value));
+    if constexpr (std::is_floating_point_v<T>) {
+        error.ulp_err = ulp_error<T>(reference, value);
+    } else {
+        const bool representable = reference >= static_cast<long double>(std::numeric_limits<T>::min())
+                                && reference <= static_cast<long double>(std::numeric_limits<T>::max());
+        error.ulp_err = representable ? static_cast<double>(std::fabs(static_cast<long double>(value) - reference)) : 0.0;
+    }
+    return error;
+}
+
+// References in long double: 64-bit significand on x86, so the result rounded
+// to double is off by at most 2^-11 ULP in all but the rarest hard cases.
+// Where long double is plain double (MSVC, AArch64 macOS) the reference is only
+// as good as libm's pow and ULP errors below ~1 are not meaningful.
+inline long double reference_pow(long double base, long double exp) {
+    return std::pow(base, exp);
+}
+
+// x^(p/q) without rounding p/q itself when q is 2 or 3; NaN for x < 0 like std::pow
+inline long double reference_pow_rational(long double x, int p, int q) {
+    if (x < 0) return std::numeric_limits<long double>::quiet_NaN();
+    long double root;
+    switch (q) {
+        case 1: root = x; break;
+        case 2: root = std::sqrt(x); break;
+        case 3: root = std::cbrt(x); break;
+        default: return std::pow(x, static_cast<long double>(p) / q);
+    }
+    return std::pow(root, static_cast<long double>(p));
+}
+
+// Accuracy contract check: tracks the largest ULP error over a dataset and the
+// worst point where a kernel exceeded its declared bound
+struct UlpContract {
+    double max_ulp = 0.0;
+    bool violated = false;
+    double worst_base = 0.0;
+    double worst_exp = 0.0;
+    bool has_exp = false;  // false for fixed-exponent kernels
+    double worst_ulp = 0.0;
+    double worst_bound = 0.0;
+
+    void add(double base, double exp, double ulp, double bound) {
+        record(base, exp, true, ulp, bound);
+    }
+
+    void add(double x, double ulp, double bound) {
+        record(x, 0.0, false, ulp, bound);
+    }
+
+    std::string message() const {
+        char buffer[160];
+        if (!has_exp) {
+            std::snprintf(buffer, sizeof(buffer), "accuracy contract violated: %.3g ULP > %.3g at x = %.17g",
+                          worst_ulp, worst_bound, worst_base);
+        } else {
+            std::snprintf(buffer, sizeof(buffer), "accuracy contract violated: %.3g ULP > %.3g at base = %.17g, exp = %.17g",
+                          worst_ulp, worst_bound, worst_base, worst_exp);
+        }
+        return buffer;
+    }
+
+private:
+    void record(double base, double exp, bool with_exp, double ulp, double bound) {
+        max_ulp = std::max(max_ulp, ulp);
+        if (ulp > bound && (!violated || ulp - bound > worst_ulp - worst_bound)) {
+            violated = true;
+            worst_base = base;
+            worst_exp = exp;
+            has_exp = with_exp;
+            worst_ulp = ulp;
+            worst_bound = bound;
+        }
+    }
+};
+
 } // namespace powerix 
\ No newline at end of file
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "pow_impl.hpp"
+#include "pow_poly.hpp"
+
+namespace powerix {
+
+// Approximate x^y for callers that can live with a relative error around
+// 1e-3 (feature scaling, activations, graphics).
+// Schraudolph's observation: the bits of a positive float read as an integer
+// are a scaled, shifted, piecewise-linear log2. Here the same split is done
+// in floating point: x = 2^e * m with m folded into [sqrt(1/2), sqrt(2)),
+// log2(m) ~= u * r(u) for u = m - 1, t = y * (e + log2(m)), and 2^t is
+// rebuilt as 2^n * q(f) with n = round(t), f = t - n and 2^n written straight
+// into the exponent fields of two factors. Refine = 0 keeps r and q linear
+// (Schraudolph's accuracy); each refinement step adds one degree to both
+// minimax polynomials. Worst relative error of x^(2/3):
+//   Refine 0: 5.1e-2   1: 4.6e-3   2: 5e-4   3: 5e-5
+// pinned at x^0 = 1 and 1^y = 1. Everything is branch-free and vectorizes.
+// Inputs must be zero or positive normal numbers: negative, subnormal, inf and
+// NaN bases give unspecified results. Past either end of the normal range the
+// result rounds once, to inf above it and to a subnormal or 0 below it (0 on
+// flush-to-zero builds), so within the relative error of those ends a finite
+// normal x^y can still come back as inf or, with flush-to-zero, as 0.
+
+inline constexpr int kPowApproxMaxRefine = 3;
+
+template <typename T>
+concept IsApproxFloat = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+namespace detail {
+
+// Minimax coefficients, lowest degree first: log2(1 + u) ~= u * r(u) for u in
+// [sqrt(1/2) - 1, sqrt(2) - 1] (absolute error) and 2^f ~= q(f) for f in
+// [-1/2, 1/2] (relative error), with q(0) = 1
+template <int Refine>
+inline constexpr auto kApproxLog2Coeffs = [] {
+    if constexpr (Refine == 0) {
+        return std::array<double, 1>{1.4142143998668122};
+    } else if constexpr (Refine == 1) {
+        return std::array<double, 2>{1.4831230150596975, -0.6991510046954869};
+    } else if constexpr (Refine == 2) {
+        return std::array<double, 3>{1.44515208381352, -0.7540817747181967, 0.4450706155764066};
+    } else {
+        return std::array<double, 4>{1.4417606320617984, -0.7249042102584454, 0.5175097478176623, -0.3296298224766502};
+    }
+}();
+
+template <int Refine>
+inline constexpr auto kApproxExp2Coeffs = [] {
+    if constexpr (Refine == 0) {
+        return std::array<double, 2>{1.0, 0.6666662940037323};
+    } else if constexpr (Refine == 1) {
+        return std::array<double, 3>{1.0, 0.7029419504265001, 0.23986409711860504};
+    } else if constexpr (Refine == 2) {
+        return std::array<double, 4>{1.0, 0.693282929176259, 0.2422109812641331, 0.05500893459456775};
+    } else {
+        return std::array<double, 5>{1.0, 0.6931241931771401, 0.24024098594889148, 0.05590642723431816, 0.009582854411656036};
+    }
+}();
+
+// Worst absolute error of u * r(u) against log2(1 + u), and relative error of q(f)
+inline constexpr std::array<double, kPowApproxMaxRefine + 1> kApproxLog2Error{8.6e-2, 5.65e-3, 8.55e-4, 1.04e-4};
+inline constexpr std::array<double, kPowApproxMaxRefine + 1> kApproxExp2Error{5.73e-2, 1.98e-3, 1.03e-4, 2.85e-6};
+
+template <typename T, std::size_t N>
+constexpr std::array<T, N> cast_coeffs(const std::array<double, N>& coeffs) {
+    std::array<T, N> out{};
+    for (std::size_t i = 0; i < N; ++i) {
+        out[i] = static_cast<T>(coeffs[i]);
+    }
+    return out;
+}
+
+} // namespace detail
+
+template <int Refine = 2, typename T>
+inline T pow_approx(T x, T y) requires IsApproxFloat<T> && (Refine >= 0 && Refine <= kPowApproxMaxRefine) {
+    using Bits = typename detail::FloatBits<T>::Bits;
+    constexpr int mant_bits = std::numeric_limits<T>::digits - 1;
+    constexpr int bias = std::numeric_limits<T>::max_exponent - 1;
+    constexpr Bits exp_mask = (Bits{1} << (sizeof(T) * 8 - 1 - mant_bits)) - 1;
+    constexpr Bits mant_mask = (Bits{1} << mant_bits) - 1;
+    // Small non-negative integers move between the low mantissa bits and T by
+    // adding 2^mant_bits, as in pow_rational_poly
+    constexpr T magic = static_cast<T>(Bits{1} << mant_bits);
+    constexpr T sqrt2 = static_cast<T>(1.41421356237309504880168872420969808L);
+    // Past both ends of the range: 2^t_min rounds to 0 and 2^t_max to inf
+    constexpr T t_min = static_cast<T>(2 - 2 * bias);
+    constexpr T t_max = static_cast<T>(2 * bias);
+    constexpr auto log2_coeffs = detail::cast_coeffs<T>(detail::kApproxLog2Coeffs<Refine>);
+    constexpr auto exp2_coeffs = detail::cast_coeffs<T>(detail::kApproxExp2Coeffs<Refine>);
+
+    const auto select = [](bool cond, T if_true, T if_false) {
+        const Bits mask = Bits{0} - static_cast<Bits>(cond);
+        return std::bit_cast<T>((std::bit_cast<Bits>(if_true) & mask) | (std::bit_cast<Bits>(if_false) & ~mask));
+    };
+
+    // log2(x) = e + log2(m), m in [sqrt(1/2), sqrt(2))
+    const Bits bits = std::bit_cast<Bits>(x);
+    T e = std::bit_cast<T>(((bits >> mant_bits) & exp_mask) | std::bit_cast<Bits>(magic)) - magic - static_cast<T>(bias);
+    T m = std::bit_cast<T>((bits & mant_mask) | std::bit_cast<Bits>(static_cast<T>(1)));
+    const bool fold = m > sqrt2;
+    m *= select(fold, static_cast<T>(0.5), static_cast<T>(1));
+    e += select(fold, static_cast<T>(1), static_cast<T>(0));
+    const T u = m - static_cast<T>(1);
+    const T t = y * (e + u * poly_horner(log2_coeffs, u));
+
+    // 2^t = 2^n * 2^f with 2^n = 2^(a - bias) * 2^(b - bias), a + b = n + 2 * bias
+    // and both a and b inside the exponent field, so the final multiply is the
+    // only rounding and a result near either end of the range is not lost early
+    const T tc = select(t < t_min, t_min, select(t > t_max, t_max, t));
+    const T n = static_cast<T>(static_cast<int32_t>(tc + select(tc < static_cast<T>(0), static_cast<T>(-0.5), static_cast<T>(0.5))));
+    const T f = tc - n;
+    const Bits k = std::bit_cast<Bits>(n + static_cast<T>(2 * bias) + magic) & mant_mask;
+    const Bits a = k >> 1;
+    const T scale_a = std::bit_cast<T>(a << mant_bits);
+    const T scale_b = std::bit_cast<T>((k - a) << mant_bits);
+    const T result = scale_a * poly_horner(exp2_coeffs, f) * scale_b;
+
+    // 0^y: 0 for y > 0, 1 for y = 0, inf for y < 0
+    const T at_zero = select(y > static_cast<T>(0), static_cast<T>(0),
+                             select(y < static_cast<T>(0), std::numeric_limits<T>::infinity(), static_cast<T>(1)));
+    return select(x == static_cast<T>(0), at_zero, result);
+}
+
+// out[i] = pow_approx(bases[i], exps[i])
+template <int Refine = 2, typename T>
+inline void pow_approx_batch(std::span<const T> bases, std::span<const T> exps, std::span<T> out) requires IsApproxFloat<T> {
+    assert(bases.size() == out.size() && exps.size() == out.size());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = pow_approx<Refine>(bases[i], exps[i]);
+    }
+}
+
+// out[i] = pow_approx(bases[i], exp)
+template <int Refine = 2, typename T>
+inline void pow_approx_batch(std::span<const T> bases, T exp, std::span<T> out) requires IsApproxFloat<T> {
+    assert(bases.size() == out.size());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = pow_approx<Refine>(bases[i], exp);
+    }
+}
+
+// Worst relative error of pow_approx<Refine>(x, y) in T for a normal result:
+// the log2 error scaled by |y|, the rounding of t (relative to |t|, which
+// grows with |log2 x|), and the 2^f error, plus a few roundings in T
+template <typename T, int Refine>
+inline double pow_approx_rel_error_bound(double x, double y) requires IsApproxFloat<T> && (Refine >= 0 && Refine <= kPowApproxMaxRefine) {
+    constexpr double eps = std::numeric_limits<T>::epsilon();
+    const double t = std::fabs(y * std::log2(x));
+    const double t_err = std::fabs(y) * (detail::kApproxLog2Error[Refine] + 2 * eps) + 2 * eps * t;
+    return std::exp2(t_err) * (1 + detail::kApproxExp2Error[Refine] + 4 * eps) - 1;
+}
+
+// The same bound at its worst over every normal result (|t| <= max_exponent)
+// not within the bound itself of overflow or, on flush-to-zero builds, of the
+// smallest normal number; usable at compile time to pick Refine for a known exponent
+template <typename T, int Refine>
+constexpr double pow_approx_max_rel_error(double y) requires IsApproxFloat<T> && (Refine >= 0 && Refine <= kPowApproxMaxRefine) {
+    constexpr double eps = std::numeric_limits<T>::epsilon();
+    const double t_err = (y < 0 ? -y : y) * (detail::kApproxLog2Error[Refine] + 2 * eps) + 2 * eps * std::numeric_limits<T>::max_exponent;
+    return static_cast<double>(detail::constexpr_exp(detail::kLn2 * t_err)) * (1 + detail::kApproxExp2Error[Refine] + 4 * eps) - 1;
+}
+
+} // namespace powerix
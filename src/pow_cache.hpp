@@ -0,0 +1,219 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "pow_impl.hpp"
+
+namespace powerix {
+
+// Thread-safe memoization cache for pow_hierarchical.
+// Entries are split across Shards independent hash maps, each behind its own
+// shared_mutex: hits take a shared lock, so concurrent readers of the same
+// shard do not serialize, and writers only block their own shard. Shards are
+// cache-line aligned so the locks of neighbouring shards do not false-share.
+// A miss computes the power outside the lock; if two threads race on the same
+// key the first insertion wins and both return the same value.
+// Shards = 1 degenerates to a single global lock (useful as a baseline).
+template <typename BaseType, typename ExpType, std::size_t Shards = 64>
+    requires IsArithmeticUnsigned<BaseType, ExpType> && (Shards > 0)
+class PowCache {
+public:
+    using Key = std::pair<BaseType, ExpType>;
+
+    BaseType get(BaseType base, ExpType exp) {
+        const Key key{base, exp};
+        const std::size_t hash = PairHash<BaseType, ExpType>{}(key);
+        Shard& shard = shards_[shard_index(hash)];
+
+        {
+            std::shared_lock lock(shard.mutex);
+            auto it = shard.map.find(key);
+            if (it != shard.map.end()) {
+                return it->second;
+            }
+        }
+
+        const BaseType result = pow_hierarchical(base, exp);
+        std::unique_lock lock(shard.mutex);
+        return shard.map.try_emplace(key, result).first->second;
+    }
+
+    BaseType operator()(BaseType base, ExpType exp) {
+        return get(base, exp);
+    }
+
+    std::size_t size() const {
+        std::size_t total = 0;
+        for (const Shard& shard : shards_) {
+            std::shared_lock lock(shard.mutex);
+            total += shard.map.size();
+        }
+        return total;
+    }
+
+    void clear() {
+        for (Shard& shard : shards_) {
+            std::unique_lock lock(shard.mutex);
+            shard.map.clear();
+        }
+    }
+
+    static constexpr std::size_t shard_count() {
+        return Shards;
+    }
+
+private:
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<Key, BaseType, PairHash<BaseType, ExpType>> map;
+    };
+
+    // PairHash keeps most entropy in the low bits; fold the high half in too
+    static constexpr std::size_t shard_index(std::size_t hash) {
+        return ((hash >> (sizeof(std::size_t) * 4)) ^ hash) % Shards;
+    }
+
+    std::array<Shard, Shards> shards_;
+};
+
+struct CacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+};
+
+// Capacity-bounded variant of PowCache with CLOCK (second chance) eviction.
+// Each shard owns capacity / Shards slots in fixed arrays plus an index from
+// key to slot. A hit only sets the slot's reference bit (a relaxed atomic
+// store), so it stays on the shared lock; this is why CLOCK is used rather
+// than LRU, whose list splice on every hit would need an exclusive lock.
+// On a miss with a full shard, the hand sweeps forward clearing reference
+// bits and evicts the first slot that was not hit since the last sweep.
+// Memory use is fixed at construction, whatever the key distribution.
+template <typename BaseType, typename ExpType, std::size_t Shards = 16>
+    requires IsArithmeticUnsigned<BaseType, ExpType> && (Shards > 0)
+class BoundedPowCache {
+public:
+    using Key = std::pair<BaseType, ExpType>;
+
+    explicit BoundedPowCache(std::size_t capacity)
+        : shard_capacity_((capacity + Shards - 1) / Shards) {
+        assert(capacity > 0);
+        for (Shard& shard : shards_) {
+            shard.keys.reserve(shard_capacity_);
+            shard.values.reserve(shard_capacity_);
+            shard.referenced = std::vector<std::atomic<uint8_t>>(shard_capacity_);
+            shard.index.reserve(shard_capacity_);
+        }
+    }
+
+    BaseType get(BaseType base, ExpType exp) {
+        const Key key{base, exp};
+        const std::size_t hash = PairHash<BaseType, ExpType>{}(key);
+        Shard& shard = shards_[shard_index(hash)];
+
+        {
+            std::shared_lock lock(shard.mutex);
+            auto it = shard.index.find(key);
+            if (it != shard.index.end()) {
+                shard.referenced[it->second].store(1, std::memory_order_relaxed);
+                shard.hits.fetch_add(1, std::memory_order_relaxed);
+                return shard.values[it->second];
+            }
+        }
+
+        shard.misses.fetch_add(1, std::memory_order_relaxed);
+        const BaseType result = pow_hierarchical(base, exp);
+
+        std::unique_lock lock(shard.mutex);
+        if (shard.index.find(key) != shard.index.end()) {
+            return result;
+        }
+
+        std::size_t slot = shard.keys.size();
+        if (slot < shard_capacity_) {
+            shard.keys.push_back(key);
+            shard.values.push_back(result);
+        } else {
+            while (shard.referenced[shard.hand].exchange(0, std::memory_order_relaxed)) {
+                shard.hand = (shard.hand + 1) % shard_capacity_;
+            }
+            slot = shard.hand;
+            shard.hand = (shard.hand + 1) % shard_capacity_;
+            shard.index.erase(shard.keys[slot]);
+            shard.keys[slot] = key;
+            shard.values[slot] = result;
+            shard.evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+        // New entries get their second chance only after a first hit
+        shard.referenced[slot].store(0, std::memory_order_relaxed);
+        shard.index.emplace(key, slot);
+        return result;
+    }
+
+    BaseType operator()(BaseType base, ExpType exp) {
+        return get(base, exp);
+    }
+
+    std::size_t size() const {
+        std::size_t total = 0;
+        for (const Shard& shard : shards_) {
+            std::shared_lock lock(shard.mutex);
+            total += shard.keys.size();
+        }
+        return total;
+    }
+
+    std::size_t capacity() const {
+        return shard_capacity_ * Shards;
+    }
+
+    CacheStats stats() const {
+        CacheStats total;
+        for (const Shard& shard : shards_) {
+            total.hits += shard.hits.load(std::memory_order_relaxed);
+            total.misses += shard.misses.load(std::memory_order_relaxed);
+            total.evictions += shard.evictions.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    void reset_stats() {
+        for (Shard& shard : shards_) {
+            shard.hits.store(0, std::memory_order_relaxed);
+            shard.misses.store(0, std::memory_order_relaxed);
+            shard.evictions.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<Key, std::size_t, PairHash<BaseType, ExpType>> index;
+        std::vector<Key> keys;
+        std::vector<BaseType> values;
+        std::vector<std::atomic<uint8_t>> referenced;
+        std::size_t hand = 0;
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+        std::atomic<uint64_t> evictions{0};
+    };
+
+    static constexpr std::size_t shard_index(std::size_t hash) {
+        return ((hash >> (sizeof(std::size_t) * 4)) ^ hash) % Shards;
+    }
+
+    std::size_t shard_capacity_;
+    std::array<Shard, Shards> shards_;
+};
+
+} // namespace powerix
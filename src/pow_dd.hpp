@@ -0,0 +1,125 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+#include "pow_impl.hpp"
+
+namespace powerix {
+
+// Double-double (compensated) integer powers.
+// A DoubleDouble is the unevaluated sum hi + lo with |lo| <= ulp(hi) / 2,
+// about 106 significant bits. Products are formed with the FMA-based TwoProd
+// (a * b = p + e exactly, e = fma(a, b, -p)), so each ladder step loses
+// ~2^-104 instead of 2^-53. Rounded back to double, base^n is within a hair
+// of 0.5 ULP whenever |result| is in [2^-916, DBL_MAX] (see
+// pow_hierarchical_dd_ulp_bound), where pow_hierarchical drifts by up to
+// n - 1 ULP. Without hardware FMA (build
+// with -mfma or -march=native) std::fma is a slow libcall.
+
+struct DoubleDouble {
+    double hi = 0.0;
+    double lo = 0.0;
+
+    constexpr DoubleDouble() = default;
+    constexpr DoubleDouble(double value) : hi(value) {}
+    constexpr DoubleDouble(double h, double l) : hi(h), lo(l) {}
+
+    // Nearest double to hi + lo
+    constexpr explicit operator double() const { return hi + lo; }
+};
+
+namespace detail {
+
+// -ffast-math lets the compiler reassociate (a + b) - a into b, which cancels
+// the error terms the transforms below exist to capture; the empty asm makes
+// the value opaque so every operation is kept as written
+inline double dd_opaque(double x) {
+#if defined(__FAST_MATH__) && defined(__GNUC__)
+#if defined(__x86_64__) || defined(__i386__)
+    __asm__("" : "+x"(x));
+#elif defined(__aarch64__)
+    __asm__("" : "+w"(x));
+#else
+    __asm__("" : "+m"(x));
+#endif
+#endif
+    return x;
+}
+
+// isfinite on the bits: -ffast-math folds std::isfinite to true, but the
+// hardware still overflows to inf and inf - inf in the transforms is NaN
+inline bool dd_is_finite(double x) {
+    constexpr uint64_t kExponentMask = 0x7ff0000000000000ull;
+    return (std::bit_cast<uint64_t>(x) & kExponentMask) != kExponentMask;
+}
+
+// s + e == a + b exactly, for |a| >= |b|
+inline DoubleDouble fast_two_sum(double a, double b) {
+    const double s = dd_opaque(a + b);
+    return {s, b - dd_opaque(s - a)};
+}
+
+// p + e == a * b exactly, barring overflow and underflow
+inline DoubleDouble two_prod(double a, double b) {
+    const double p = dd_opaque(a * b);
+    return {p, std::fma(a, b, -p)};
+}
+
+} // namespace detail
+
+// Relative error below 2^-104 (the cross terms lo * lo are dropped). An
+// overflow to inf keeps lo at 0, so the result reads back as inf, not NaN.
+inline DoubleDouble operator*(DoubleDouble a, DoubleDouble b) {
+    DoubleDouble p = detail::two_prod(a.hi, b.hi);
+    if (!detail::dd_is_finite(p.hi)) return {p.hi, 0.0};
+    p.lo += a.hi * b.lo + a.lo * b.hi;
+    return detail::fast_two_sum(p.hi, p.lo);
+}
+
+// 1 / a: Newton correction of the double reciprocal with the exact residual;
+// 1 / inf and 1 / 0 come back as 0 and inf
+inline DoubleDouble dd_reciprocal(DoubleDouble a) {
+    const double q = 1.0 / a.hi;
+    if (!detail::dd_is_finite(a.hi) || !detail::dd_is_finite(q)) return {q, 0.0};
+    const DoubleDouble qa = detail::two_prod(q, a.hi);
+    const double residual = (detail::dd_opaque(1.0 - qa.hi) - qa.lo) - q * a.lo;
+    return detail::fast_two_sum(q, residual * q);
+}
+
+// Hierarchical ladder on double-double: the first squaring of a plain double
+// is exact, every later step rounds at 2^-104
+template <typename ExpType>
+inline DoubleDouble pow_dd(DoubleDouble base, ExpType exp) requires std::is_unsigned_v<ExpType> {
+    if (exp == 0) return DoubleDouble(1.0);
+    if (exp == 1) return base;
+    const DoubleDouble half = pow_dd(base * base, static_cast<ExpType>(exp >> 1));
+    return (exp & 1u) ? base * half : half;
+}
+
+template <typename ExpType>
+inline DoubleDouble pow_dd(DoubleDouble base, ExpType exp) requires std::is_integral_v<ExpType> && std::is_signed_v<ExpType> {
+    const DoubleDouble power = pow_dd(base, detail::exp_magnitude(exp));
+    return exp < 0 ? dd_reciprocal(power) : power;
+}
+
+// base^exp rounded once from double-double: the high-accuracy counterpart of
+// pow_hierarchical(double, exp)
+template <typename ExpType>
+inline double pow_hierarchical_dd(double base, ExpType exp) requires std::is_integral_v<ExpType> {
+    return static_cast<double>(pow_dd(DoubleDouble(base), exp));
+}
+
+// Contract of pow_hierarchical_dd in ULP of double: the final rounding
+// (0.5) plus ~2^-50 per double-double step (2^-104 relative is at most 2^-51
+// ULP), and 2^-10 of slack for the long double reference it is checked with.
+// Holds for |result| in [2^-916, DBL_MAX]: below, lo is subnormal (or
+// flushed to zero under -ffast-math) and the error grows toward the plain
+// ladder's.
+constexpr double pow_hierarchical_dd_ulp_bound(double exp) {
+    return 0.5 + 0x1p-10 + (pow_ladder_ulp_bound(exp) + 1.0) * 0x1p-50;
+}
+
+} // namespace powerix
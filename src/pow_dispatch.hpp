@@ -0,0 +1,138 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include "pow_impl.hpp"
+#include "pow_simd.hpp"
+
+namespace powerix {
+
+// Runtime CPU dispatch: one binary picks the widest kernel the CPU supports.
+// The kernel table is built once, on first use, from cpuid; setting the
+// POWERIX_ISA environment variable (scalar, sse4, avx2, avx512, any case) caps
+// the selection, which is handy to compare ISAs on the same machine.
+// Every entry runs pow_binary's ladder, so pow_binary_dispatch returns
+// pow_binary_batch's bits whichever ISA is picked.
+
+enum class Isa {
+    Scalar,
+    SSE4,
+    AVX2,
+    AVX512,
+};
+
+inline const char* isa_name(Isa isa) {
+    switch (isa) {
+        case Isa::SSE4: return "sse4";
+        case Isa::AVX2: return "avx2";
+        case Isa::AVX512: return "avx512";
+        default: return "scalar";
+    }
+}
+
+inline bool isa_supported(Isa isa) {
+    switch (isa) {
+        case Isa::SSE4: return cpu_supports_sse4();
+        case Isa::AVX2: return cpu_supports_avx2();
+        case Isa::AVX512: return cpu_supports_avx512();
+        default: return true;
+    }
+}
+
+// ISA named by a POWERIX_ISA value, ignoring case; nullopt if unknown
+inline std::optional<Isa> parse_isa(std::string_view name) {
+    const auto same = [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) == b;
+    };
+    for (Isa isa : {Isa::Scalar, Isa::SSE4, Isa::AVX2, Isa::AVX512}) {
+        const std::string_view expected = isa_name(isa);
+        if (std::equal(name.begin(), name.end(), expected.begin(), expected.end(), same)) {
+            return isa;
+        }
+    }
+    return std::nullopt;
+}
+
+// Widest ISA supported by the CPU, capped by POWERIX_ISA when set and not
+// empty. An unknown value leaves the selection uncapped and is reported once
+// on stderr.
+inline Isa detect_isa() {
+    Isa cap = Isa::AVX512;
+    if (const char* env = std::getenv("POWERIX_ISA"); env != nullptr && *env != '\0') {
+        if (const auto isa = parse_isa(env)) {
+            cap = *isa;
+        } else {
+            [[maybe_unused]] static const bool warned = [env] {
+                std::fprintf(stderr, "powerix: ignoring unknown POWERIX_ISA value '%s' (expected scalar, sse4, avx2 or avx512)\n", env);
+                return true;
+            }();
+        }
+    }
+
+    for (Isa isa : {Isa::AVX512, Isa::AVX2, Isa::SSE4}) {
+        if (isa <= cap && isa_supported(isa)) {
+            return isa;
+        }
+    }
+    return Isa::Scalar;
+}
+
+// Portable fallbacks with the same signature as the SIMD kernels. They run the
+// SIMD kernels' right-to-left ladder (pow_binary), so every entry of the
+// table returns the same bits.
+inline void pow_binary_scalar(const double* bases, const uint32_t* exps, double* out, std::size_t n) {
+    pow_binary_batch(std::span<const double>(bases, n), std::span<const uint32_t>(exps, n), std::span<double>(out, n));
+}
+
+inline void pow_binary_scalar(const double* bases, uint32_t exp, double* out, std::size_t n) {
+    pow_binary_batch(std::span<const double>(bases, n), exp, std::span<double>(out, n));
+}
+
+struct PowKernelTable {
+    using BinaryKernel = void (*)(const double*, const uint32_t*, double*, std::size_t);
+    using BinaryBroadcastKernel = void (*)(const double*, uint32_t, double*, std::size_t);
+
+    Isa isa;
+    BinaryKernel binary;
+    BinaryBroadcastKernel binary_broadcast;
+};
+
+// Kernel table for a given ISA; the caller is responsible for isa_supported(isa)
+inline PowKernelTable make_kernel_table(Isa isa) {
+    switch (isa) {
+#if POWERIX_HAS_X86_SIMD
+        case Isa::SSE4: return {isa, &pow_binary_sse4, &pow_binary_sse4};
+        case Isa::AVX2: return {isa, &pow_binary_avx2, &pow_binary_avx2};
+        case Isa::AVX512: return {isa, &pow_binary_avx512, &pow_binary_avx512};
+#endif
+        default: return {Isa::Scalar, &pow_binary_scalar, &pow_binary_scalar};
+    }
+}
+
+// Table selected for this process, initialized once (thread-safe static)
+inline const PowKernelTable& pow_kernels() {
+    static const PowKernelTable table = make_kernel_table(detect_isa());
+    return table;
+}
+
+// Dispatched entry points
+inline void pow_binary_dispatch(std::span<const double> bases, std::span<const uint32_t> exps, std::span<double> out) {
+    assert(bases.size() == out.size() && exps.size() == out.size());
+    pow_kernels().binary(bases.data(), exps.data(), out.data(), out.size());
+}
+
+inline void pow_binary_dispatch(std::span<const double> bases, uint32_t exp, std::span<double> out) {
+    assert(bases.size() == out.size());
+    pow_kernels().binary_broadcast(bases.data(), exp, out.data(), out.size());
+}
+
+} // namespace powerix
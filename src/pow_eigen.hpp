@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include <Eigen/Core>
+
+namespace powerix {
+
+// Eigen array kernels, kept apart from pow_impl.hpp so that only code built
+// against powerix::eigen (which defines POWERIX_HAS_EIGEN) pays for the Eigen
+// headers.
+
+// Batched pow(x, 2/3) through Eigen array expressions over the spans (no copy):
+//  - Pow: Array::pow with a scalar exponent (Eigen's vectorized generic_pow)
+//  - ExpLog: exp(2/3 * log(x)) with Eigen's vectorized log and exp
+//  - CbrtSquare: cbrt(x)^2; Eigen 3.4 has no array cbrt, so the root is a
+//    scalar std::cbrt per element and only the square is vectorized
+enum class EigenPowMethod { Pow, ExpLog, CbrtSquare };
+
+template <EigenPowMethod Method = EigenPowMethod::Pow, typename BaseType>
+inline void pow_2_3_eigen(std::span<const BaseType> bases, std::span<BaseType> out) requires std::is_floating_point_v<BaseType> {
+    assert(bases.size() == out.size());
+    using Array = Eigen::Array<BaseType, Eigen::Dynamic, 1>;
+    const auto n = static_cast<Eigen::Index>(out.size());
+    const Eigen::Map<const Array> x(bases.data(), n);
+    Eigen::Map<Array> y(out.data(), n);
+    constexpr BaseType two_thirds = static_cast<BaseType>(2.0 / 3.0);
+
+    if constexpr (Method == EigenPowMethod::Pow) {
+        y = x.pow(two_thirds);
+    } else if constexpr (Method == EigenPowMethod::ExpLog) {
+        y = (two_thirds * x.log()).exp();
+    } else {
+        y = x.unaryExpr([](BaseType v) { return std::cbrt(v); }).square();
+    }
+}
+
+// Contract, in ULP of BaseType: Pow and ExpLog round 2/3 to BaseType, which
+// moves the result by a relative |delta * log(x)|; on top of that generic_pow
+// stays within 1 ULP, and ExpLog carries the exp(y) amplification of
+// pow_2_3_exp_log. CbrtSquare doubles the cbrt error and rounds once more.
+template <EigenPowMethod Method, typename BaseType>
+inline double pow_2_3_eigen_ulp_bound(double x) {
+    constexpr long double delta = 2.0L / 3 - static_cast<long double>(static_cast<BaseType>(2.0 / 3.0));
+    const double log_x = std::fabs(std::log(x));
+    const double rounding = static_cast<double>((delta < 0 ? -delta : delta) * log_x * 2 / std::numeric_limits<BaseType>::epsilon());
+    if constexpr (Method == EigenPowMethod::Pow) {
+        return 1.0 + rounding;
+    } else if constexpr (Method == EigenPowMethod::ExpLog) {
+        return 2.0 + 3.5 * (2.0 / 3.0) * log_x + rounding;
+    } else {
+        return 9.0;
+    }
+}
+
+} // namespace powerix
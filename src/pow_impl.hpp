@@ -1,13 +1,23 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
 #include <cmath>
+#include <cstddef>
+#include <concepts>
+#include <cstdint>
+#include <span>
 #include <vector>
 #include <map>
+#include <numeric>
 #include <type_traits>
 #include <functional>
 #include <optional>
 #include <limits>
 #include <unordered_map>
+#include <utility>
 
 namespace powerix {
 
@@ -24,6 +34,19 @@ concept IsIntegralUnsigned = std::is_integral_v<BaseType> && std::is_unsigned_v<
 template <typename BaseType, typename ExpType>
 concept IsArithmeticFloating = IsArithmetic<BaseType> && std::is_floating_point_v<ExpType>;
 
+template <typename BaseType, typename ExpType>
+concept IsArithmeticSigned = IsArithmetic<BaseType> && std::is_integral_v<ExpType> && std::is_signed_v<ExpType>;
+
+// x < 0 without a tautological comparison for unsigned types
+template <typename T>
+constexpr bool is_negative(T x) {
+    if constexpr (std::is_signed_v<T>) {
+        return x < 0;
+    } else {
+        return false;
+    }
+}
+
 extern "C" {
     double pow(double x, double y);
     float powf(float x, float y);
@@ -97,6 +120,527 @@ inline BaseType pow_ultra_fast(BaseType base, ExpType exp) requires IsArithmetic
     return result * base;
 }
 
+namespace detail {
+
+// |exp| as an unsigned value, well defined for the most negative exponent
+template <typename ExpType>
+constexpr std::make_unsigned_t<ExpType> exp_magnitude(ExpType exp) {
+    using Unsigned = std::make_unsigned_t<ExpType>;
+    return exp < 0 ? static_cast<Unsigned>(Unsigned(0) - static_cast<Unsigned>(exp)) : static_cast<Unsigned>(exp);
+}
+
+// Integer base^-n truncated toward zero: only 1 and -1 survive. 0^-n is a
+// division by zero; it asserts in debug builds and returns 0 otherwise.
+template <typename BaseType, typename ExpType>
+constexpr BaseType pow_integral_negative(BaseType base, ExpType magnitude) {
+    assert(base != 0);
+    if (base == 1) return 1;
+    if (is_negative(base) && base == static_cast<BaseType>(-1)) {
+        return (magnitude & 1u) ? base : static_cast<BaseType>(1);
+    }
+    return 0;
+}
+
+} // namespace detail
+
+// Signed exponents: the kernels run on |exp|, and a negative exponent costs a
+// single reciprocal at the end for floating bases
+template <typename BaseType, typename ExpType>
+inline BaseType pow_binary(BaseType base, ExpType exp) requires IsArithmeticSigned<BaseType, ExpType> {
+    const auto magnitude = detail::exp_magnitude(exp);
+    if constexpr (std::is_floating_point_v<BaseType>) {
+        const BaseType power = pow_binary(base, magnitude);
+        return exp < 0 ? static_cast<BaseType>(1) / power : power;
+    } else {
+        // The ladder squares once more after the last set bit, so run it in an
+        // unsigned type (no narrower than unsigned) where that square wraps
+        using Wide = std::make_unsigned_t<std::common_type_t<BaseType, unsigned>>;
+        return exp < 0 ? detail::pow_integral_negative(base, magnitude)
+                       : static_cast<BaseType>(pow_binary(static_cast<Wide>(base), magnitude));
+    }
+}
+
+template <typename BaseType, typename ExpType>
+inline BaseType pow_hierarchical(BaseType base, ExpType exp) requires IsArithmeticSigned<BaseType, ExpType> {
+    const auto magnitude = detail::exp_magnitude(exp);
+    if constexpr (std::is_floating_point_v<BaseType>) {
+        const BaseType power = pow_hierarchical(base, magnitude);
+        return exp < 0 ? static_cast<BaseType>(1) / power : power;
+    } else {
+        return exp < 0 ? detail::pow_integral_negative(base, magnitude) : pow_hierarchical(base, magnitude);
+    }
+}
+
+template <typename BaseType, typename ExpType>
+inline BaseType pow_ultra_fast(BaseType base, ExpType exp) requires IsArithmeticSigned<BaseType, ExpType> {
+    const auto magnitude = detail::exp_magnitude(exp);
+    if constexpr (std::is_floating_point_v<BaseType>) {
+        const BaseType power = pow_ultra_fast(base, magnitude);
+        return exp < 0 ? static_cast<BaseType>(1) / power : power;
+    } else {
+        return exp < 0 ? detail::pow_integral_negative(base, magnitude) : pow_ultra_fast(base, magnitude);
+    }
+}
+
+// Generic monoid exponentiation: the same ladders for any type with an
+// associative multiply and an identity, e.g. std::complex, Eigen fixed-size
+// matrices (linear recurrences), Eigen quaternions or user types.
+// monoid_traits<T> is the customization point; the primary template covers
+// types with operator* and either a T::Identity(rows, cols) / T::Identity()
+// factory (Eigen) or a T(1) unit (std::complex). Specialize it for anything
+// else, e.g. a (max, +) semiring whose multiply is + and identity is 0.
+
+template <typename T>
+concept HasSizedIdentity = requires(const T& x) {
+    { T::Identity(x.rows(), x.cols()) } -> std::convertible_to<T>;
+};
+
+template <typename T>
+concept HasStaticIdentity = requires {
+    { T::Identity() } -> std::convertible_to<T>;
+};
+
+template <typename T>
+struct monoid_traits {
+    // identity takes an element so dynamic-size matrices get the right shape
+    static T identity(const T& x) requires HasSizedIdentity<T> {
+        return T::Identity(x.rows(), x.cols());
+    }
+    static T identity(const T&) requires (!HasSizedIdentity<T> && HasStaticIdentity<T>) {
+        return T::Identity();
+    }
+    static T identity(const T&) requires (!HasSizedIdentity<T> && !HasStaticIdentity<T> && std::is_constructible_v<T, int>) {
+        return T(1);
+    }
+
+    // Returns T, so expression templates are evaluated once per step
+    static T multiply(const T& a, const T& b) requires requires { { a * b } -> std::convertible_to<T>; } {
+        return a * b;
+    }
+};
+
+template <typename T>
+concept IsMonoid = requires(const T& a, const T& b) {
+    { monoid_traits<T>::identity(a) } -> std::convertible_to<T>;
+    { monoid_traits<T>::multiply(a, b) } -> std::convertible_to<T>;
+};
+
+// Built-in arithmetic types keep the overloads above
+template <typename BaseType, typename ExpType>
+concept IsMonoidUnsigned = !IsArithmetic<BaseType> && IsMonoid<BaseType> && std::is_unsigned_v<ExpType>;
+
+template <typename BaseType, typename ExpType>
+inline BaseType pow_binary(const BaseType& base, ExpType exp) requires IsMonoidUnsigned<BaseType, ExpType> {
+    using Traits = monoid_traits<BaseType>;
+    if (exp == 0) return Traits::identity(base);
+
+    // Start from the lowest set bit instead of multiplying into the identity
+    BaseType current = base;
+    while ((exp & 1u) == 0) {
+        current = Traits::multiply(current, current);
+        exp >>= 1;
+    }
+    BaseType result = current;
+    exp >>= 1;
+
+    while (exp > 0) {
+        current = Traits::multiply(current, current);
+        if (exp & 1u) {
+            result = Traits::multiply(result, current);
+        }
+        exp >>= 1;
+    }
+
+    return result;
+}
+
+template <typename BaseType, typename ExpType>
+inline BaseType pow_hierarchical(const BaseType& base, ExpType exp) requires IsMonoidUnsigned<BaseType, ExpType> {
+    using Traits = monoid_traits<BaseType>;
+    if (exp == 0) return Traits::identity(base);
+    if (exp == 1) return base;
+    BaseType half = pow_hierarchical(Traits::multiply(base, base), static_cast<ExpType>(exp >> 1));
+    return (exp & 1u) ? Traits::multiply(base, half) : half;
+}
+
+// Accuracy contract of the integer-exponent ladders (pow_binary,
+// pow_hierarchical, pow_ultra_fast, pow_static and their batch forms) for
+// floating bases, in ULP of BaseType: every multiply rounds once and squaring
+// doubles the relative error already in the factor, so base^n stays within
+// n - 1 roundings; a negative exponent adds the final reciprocal. Integer
+// bases are exact whenever the result is representable.
+constexpr double pow_ladder_ulp_bound(double exp) {
+    const double n = exp < 0 ? -exp : exp;
+    return std::max(n - 1.0, 0.0) + (exp < 0 ? 1.0 : 0.0);
+}
+
+namespace detail {
+
+enum class PowOverflow { Fits, Overflows, Unknown };
+
+// Classifies base^exp from the bit width w of |base|: the magnitude lies in
+// [2^((w-1)*exp), 2^(w*exp)), so most inputs are decided without multiplying.
+template <typename BaseType, typename ExpType>
+constexpr PowOverflow classify_pow_overflow(BaseType base, ExpType exp) {
+    using Unsigned = std::make_unsigned_t<BaseType>;
+    constexpr unsigned digits = std::numeric_limits<BaseType>::digits;
+    const Unsigned magnitude = is_negative(base) ? static_cast<Unsigned>(Unsigned(0) - static_cast<Unsigned>(base)) : static_cast<Unsigned>(base);
+    const unsigned width = static_cast<unsigned>(std::bit_width(magnitude));
+
+    if (width <= 1) return PowOverflow::Fits;   // 0, 1, -1
+    if (exp > digits) return PowOverflow::Overflows;
+    const unsigned e = static_cast<unsigned>(exp);
+    if (width * e <= digits) return PowOverflow::Fits;
+    if ((width - 1) * e > digits) return PowOverflow::Overflows;
+    return PowOverflow::Unknown;
+}
+
+// Binary ladder on __builtin_mul_overflow for the inputs the bound cannot
+// decide. The flag is accumulated with | so the ladder has no extra branch,
+// and the last square is skipped since its overflow would not matter.
+template <typename BaseType, typename ExpType>
+inline BaseType pow_mul_overflow(BaseType base, ExpType exp, bool& overflow) {
+    BaseType result = static_cast<BaseType>(1);
+    bool wrapped = false;
+
+    while (true) {
+        if (exp & 1u) {
+            wrapped |= __builtin_mul_overflow(result, base, &result);
+        }
+        exp >>= 1;
+        if (exp == 0) break;
+        wrapped |= __builtin_mul_overflow(base, base, &base);
+    }
+
+    overflow = wrapped;
+    return result;
+}
+
+// Hot-path half of classify_pow_overflow: bit_width(|base|) * exp <= digits
+// means base^exp fits. Folded into a single branch; the exponent test only
+// keeps the product from wrapping.
+template <typename BaseType, typename ExpType>
+constexpr bool pow_surely_fits(BaseType base, ExpType exp) {
+    using Unsigned = std::make_unsigned_t<BaseType>;
+    constexpr unsigned digits = std::numeric_limits<BaseType>::digits;
+    const Unsigned magnitude = is_negative(base) ? static_cast<Unsigned>(Unsigned(0) - static_cast<Unsigned>(base)) : static_cast<Unsigned>(base);
+    const unsigned width = static_cast<unsigned>(std::bit_width(magnitude));
+    return (exp <= digits) & (width * static_cast<unsigned>(exp) <= digits);
+}
+
+// Everything pow_surely_fits leaves open, kept out of line so the checked
+// kernels inline to the test plus pow_hierarchical
+template <typename BaseType, typename ExpType>
+[[gnu::noinline]] BaseType pow_checked_slow(BaseType base, ExpType exp, bool& overflow) {
+    switch (classify_pow_overflow(base, exp)) {
+        case PowOverflow::Fits:
+            overflow = false;
+            return pow_hierarchical(base, exp);
+        case PowOverflow::Overflows: {
+            overflow = true;
+            // Wrap in an unsigned type at least as wide as unsigned, so 8- and
+            // 16-bit bases do not promote to int and overflow it
+            using Wide = std::make_unsigned_t<std::common_type_t<BaseType, unsigned>>;
+            return static_cast<BaseType>(pow_hierarchical(static_cast<Wide>(base), exp));
+        }
+        default:
+            return pow_mul_overflow(base, exp, overflow);
+    }
+}
+
+template <typename BaseType, typename ExpType>
+[[gnu::noinline]] BaseType pow_saturating_slow(BaseType base, ExpType exp) {
+    bool overflow;
+    const BaseType result = pow_checked_slow(base, exp, overflow);
+    if (!overflow) {
+        return result;
+    }
+    if constexpr (std::is_signed_v<BaseType>) {
+        if (base < 0 && (exp & 1u)) {
+            return std::numeric_limits<BaseType>::min();
+        }
+    }
+    return std::numeric_limits<BaseType>::max();
+}
+
+} // namespace detail
+
+// Overflow-checked integer power: the wrapped result, with overflow set when
+// base^exp does not fit in BaseType
+template <typename BaseType, typename ExpType>
+inline BaseType pow_checked(BaseType base, ExpType exp, bool& overflow) requires IsIntegralUnsigned<BaseType, ExpType> {
+    if (detail::pow_surely_fits(base, exp)) [[likely]] {
+        overflow = false;
+        return pow_hierarchical(base, exp);
+    }
+    return detail::pow_checked_slow(base, exp, overflow);
+}
+
+template <typename BaseType, typename ExpType>
+inline std::optional<BaseType> pow_checked(BaseType base, ExpType exp) requires IsIntegralUnsigned<BaseType, ExpType> {
+    if (detail::pow_surely_fits(base, exp)) [[likely]] {
+        return pow_hierarchical(base, exp);
+    }
+    bool overflow;
+    const BaseType result = detail::pow_checked_slow(base, exp, overflow);
+    if (overflow) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+// Integer power clamped to the range of BaseType on overflow
+template <typename BaseType, typename ExpType>
+inline BaseType pow_saturating(BaseType base, ExpType exp) requires IsIntegralUnsigned<BaseType, ExpType> {
+    if (detail::pow_surely_fits(base, exp)) [[likely]] {
+        return pow_hierarchical(base, exp);
+    }
+    return detail::pow_saturating_slow(base, exp);
+}
+
+namespace detail {
+
+// Addition chain 1 = value[0] < value[1] < ... < value[length] = N where every
+// step is value[i] = value[i - 1] + value[operand[i]] (a star chain).
+struct AdditionChain {
+    static constexpr std::size_t max_length = 64;
+    std::array<unsigned, max_length + 1> value{};
+    std::array<unsigned, max_length + 1> operand{};
+    std::size_t length = 0;
+};
+
+// Star chains are optimal for every N below 12509, so a depth-limited search
+// over them yields a shortest chain.
+constexpr bool search_star_chain(AdditionChain& chain, std::size_t k, std::size_t limit, unsigned n) {
+    const unsigned last = chain.value[k];
+    if (last == n) {
+        chain.length = k;
+        return true;
+    }
+    if (k == limit) return false;
+    // Even doubling at every remaining step cannot reach n
+    if ((static_cast<unsigned long long>(last) << (limit - k)) < n) return false;
+
+    for (std::size_t j = k + 1; j-- > 0;) {
+        const unsigned next = last + chain.value[j];
+        if (next > n) continue;
+        if ((static_cast<unsigned long long>(next) << (limit - k - 1)) < n) break;
+        chain.value[k + 1] = next;
+        chain.operand[k + 1] = static_cast<unsigned>(j);
+        if (search_star_chain(chain, k + 1, limit, n)) return true;
+    }
+    return false;
+}
+
+// Left-to-right binary chain: double for every bit, add 1 for every set bit
+constexpr AdditionChain binary_addition_chain(unsigned n) {
+    AdditionChain chain;
+    chain.value[0] = 1;
+    std::size_t k = 0;
+    for (int bit = std::bit_width(n) - 2; bit >= 0; --bit) {
+        chain.value[k + 1] = chain.value[k] * 2;
+        chain.operand[k + 1] = static_cast<unsigned>(k);
+        ++k;
+        if ((n >> bit) & 1u) {
+            chain.value[k + 1] = chain.value[k] + 1;
+            chain.operand[k + 1] = 0;
+            ++k;
+        }
+    }
+    chain.length = k;
+    return chain;
+}
+
+// Exponents up to this bound get a shortest chain; the exhaustive search grows
+// too expensive for the constexpr evaluator beyond it.
+inline constexpr unsigned kMaxOptimalChainExp = 255;
+
+constexpr AdditionChain shortest_addition_chain(unsigned n) {
+    if (n > kMaxOptimalChainExp) return binary_addition_chain(n);
+
+    AdditionChain chain;
+    chain.value[0] = 1;
+    if (n <= 1) return chain;
+
+    std::size_t limit = 0;
+    while ((1ull << limit) < n) ++limit;
+    while (!search_star_chain(chain, 0, limit, n)) ++limit;
+    return chain;
+}
+
+} // namespace detail
+
+// Compile-time exponent: unrolled multiply sequence of a shortest addition chain
+// (e.g. x^15 in 5 multiplies instead of 6 with binary exponentiation).
+// Exponents above detail::kMaxOptimalChainExp fall back to the binary chain.
+template <unsigned N, typename BaseType>
+constexpr BaseType pow_static(BaseType base) requires IsArithmetic<BaseType> {
+    if constexpr (N == 0) {
+        return static_cast<BaseType>(1);
+    } else {
+        constexpr detail::AdditionChain chain = detail::shortest_addition_chain(N);
+        std::array<BaseType, chain.length + 1> values{};
+        values[0] = base;
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((values[I + 1] = static_cast<BaseType>(values[I] * values[chain.operand[I + 1]])), ...);
+        }(std::make_index_sequence<chain.length>{});
+        return values[chain.length];
+    }
+}
+
+// Batched kernels over contiguous arrays
+// out[i] = base[i]^exp[i]; all spans must have the same length.
+template <typename BaseType, typename ExpType, typename OutType>
+inline void pow_hierarchical_batch(std::span<const BaseType> bases, std::span<const ExpType> exps, std::span<OutType> out) requires IsArithmeticUnsigned<BaseType, ExpType> {
+    assert(bases.size() == out.size() && exps.size() == out.size());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = static_cast<OutType>(pow_hierarchical(bases[i], exps[i]));
+    }
+}
+
+// Broadcast exponent: out[i] = base[i]^exp.
+// The exponent is loop-invariant, so the ladder runs on the outside and each
+// rung is a straight loop over a block of elements that the compiler can
+// vectorize. Rungs are combined in pow_hierarchical's order (squares first,
+// then set bits multiplied in from the top), so floating-point results match
+// the per-element overload bit for bit.
+template <typename BaseType, typename ExpType, typename OutType>
+inline void pow_hierarchical_batch(std::span<const BaseType> bases, ExpType exp, std::span<OutType> out) requires IsArithmeticUnsigned<BaseType, ExpType> {
+    assert(bases.size() == out.size());
+    constexpr std::size_t block = 64;
+    BaseType current[block];
+    // Squares at the set bits below the top one
+    BaseType rungs[std::numeric_limits<ExpType>::digits][block];
+
+    for (std::size_t start = 0; start < out.size(); start += block) {
+        const std::size_t n = std::min(block, out.size() - start);
+        if (exp == 0) {
+            for (std::size_t i = 0; i < n; ++i) out[start + i] = static_cast<OutType>(static_cast<BaseType>(1));
+            continue;
+        }
+        for (std::size_t i = 0; i < n; ++i) current[i] = bases[start + i];
+        std::size_t stored = 0;
+        for (ExpType e = exp; e > 1; e >>= 1) {
+            if (e & 1) {
+                for (std::size_t i = 0; i < n; ++i) rungs[stored][i] = current[i];
+                ++stored;
+            }
+            for (std::size_t i = 0; i < n; ++i) current[i] *= current[i];
+        }
+        while (stored > 0) {
+            --stored;
+            for (std::size_t i = 0; i < n; ++i) current[i] = static_cast<BaseType>(rungs[stored][i] * current[i]);
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            out[start + i] = static_cast<OutType>(current[i]);
+        }
+    }
+}
+
+template <typename BaseType, typename ExpType, typename OutType>
+inline void pow_binary_batch(std::span<const BaseType> bases, std::span<const ExpType> exps, std::span<OutType> out) requires IsArithmeticUnsigned<BaseType, ExpType> {
+    assert(bases.size() == out.size() && exps.size() == out.size());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = static_cast<OutType>(pow_binary(bases[i], exps[i]));
+    }
+}
+
+template <typename BaseType, typename ExpType, typename OutType>
+inline void pow_binary_batch(std::span<const BaseType> bases, ExpType exp, std::span<OutType> out) requires IsArithmeticUnsigned<BaseType, ExpType> {
+    assert(bases.size() == out.size());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = static_cast<OutType>(pow_binary(bases[i], exp));
+    }
+}
+
+template <typename BaseType, typename ExpType, typename OutType>
+inline void pow_ultra_fast_batch(std::span<const BaseType> bases, std::span<const ExpType> exps, std::span<OutType> out) requires IsArithmeticUnsigned<BaseType, ExpType> {
+    assert(bases.size() == out.size() && exps.size() == out.size());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = static_cast<OutType>(pow_ultra_fast(bases[i], exps[i]));
+    }
+}
+
+template <typename BaseType, typename ExpType, typename OutType>
+inline void pow_ultra_fast_batch(std::span<const BaseType> bases, ExpType exp, std::span<OutType> out) requires IsArithmeticUnsigned<BaseType, ExpType> {
+    assert(bases.size() == out.size());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = static_cast<OutType>(pow_ultra_fast(bases[i], exp));
+    }
+}
+
+// All consecutive powers: out[k] = base^k for k in [0, out.size()), about
+// one multiply per power instead of a ladder per power. After the first
+// kPowAllStride powers, out[k] = out[k - kPowAllStride] * base^kPowAllStride,
+// so the stride-wide inner loop has no dependency between its lanes and
+// vectorizes. Every out[k] stays within pow_ladder_ulp_bound(k).
+inline constexpr std::size_t kPowAllStride = 8;
+
+template <typename BaseType>
+inline void pow_all(BaseType base, std::span<BaseType> out) requires IsArithmetic<BaseType> {
+    const std::size_t count = out.size();
+    BaseType current = static_cast<BaseType>(1);
+    const std::size_t head = std::min(count, kPowAllStride);
+    for (std::size_t k = 0; k < head; ++k) {
+        out[k] = current;
+        current *= base;
+    }
+    if (count <= kPowAllStride) return;
+
+    const BaseType stride_power = current;  // base^kPowAllStride
+    std::size_t k = kPowAllStride;
+    for (; k + kPowAllStride <= count; k += kPowAllStride) {
+        for (std::size_t j = 0; j < kPowAllStride; ++j) {
+            out[k + j] = out[k - kPowAllStride + j] * stride_power;
+        }
+    }
+    for (; k < count; ++k) {
+        out[k] = out[k - kPowAllStride] * stride_power;
+    }
+}
+
+enum class VandermondeLayout {
+    RowMajor,  // row i is bases[i]^0 .. bases[i]^degree
+    ColMajor,  // column k is bases[0]^k .. bases[n-1]^k
+};
+
+// Vandermonde block V[i][k] = bases[i]^k for k in [0, degree], out holding
+// bases.size() * (degree + 1) values in the given layout. Row-major runs
+// pow_all on each row; column-major walks the columns with one multiply per
+// element, vectorized across bases, over blocks of bases that stay in L1.
+template <VandermondeLayout Layout = VandermondeLayout::RowMajor, typename BaseType>
+inline void pow_vandermonde(std::span<const BaseType> bases, std::size_t degree, std::span<BaseType> out) requires IsArithmetic<BaseType> {
+    const std::size_t n = bases.size();
+    const std::size_t columns = degree + 1;
+    assert(out.size() == n * columns);
+
+    if constexpr (Layout == VandermondeLayout::RowMajor) {
+        for (std::size_t i = 0; i < n; ++i) {
+            pow_all(bases[i], out.subspan(i * columns, columns));
+        }
+    } else {
+        constexpr std::size_t block = 256;
+        BaseType current[block];
+        for (std::size_t start = 0; start < n; start += block) {
+            const std::size_t m = std::min(block, n - start);
+            for (std::size_t i = 0; i < m; ++i) {
+                current[i] = static_cast<BaseType>(1);
+            }
+            for (std::size_t k = 0; k < columns; ++k) {
+                BaseType* column = out.data() + k * n + start;
+                for (std::size_t i = 0; i < m; ++i) {
+                    column[i] = current[i];
+                    current[i] *= bases[start + i];
+                }
+            }
+        }
+    }
+}
+
+// The pow_cached_* functions below keep their cache in a function-local static
+// with no synchronization: single-threaded use only. Use PowCache
+// (pow_cache.hpp) when calling from several threads.
+
 // Memoization with std::map
 template <typename BaseType, typename ExpType, typename ResultType = std::conditional_t<std::is_floating_point_v<BaseType> || std::is_floating_point_v<ExpType>, std::common_type_t<BaseType, ExpType>, BaseType>>
 inline ResultType pow_cached_map(BaseType base, ExpType exp) requires IsIntegralUnsigned<BaseType, ExpType> {
@@ -159,9 +703,11 @@ inline ResultType pow_cached_unordered_pair(BaseType base, ExpType exp) requires
 }
 
 // Memoization with vector<vector<optional>> for integer types
-template <typename BaseType, typename ExpType>
+// Only (base, exp) below (MAX_BASE, MAX_EXP) are cached, so the table never
+// grows past MAX_BASE * MAX_EXP entries; anything else is computed directly.
+template <typename BaseType, typename ExpType, size_t MAX_BASE = 4096, size_t MAX_EXP = 64>
 inline BaseType pow_cached_vector_optional(BaseType base, ExpType exp) requires IsIntegralUnsigned<BaseType, ExpType> {
-    if (base < 0) {
+    if (is_negative(base) || static_cast<std::make_unsigned_t<BaseType>>(base) >= MAX_BASE || exp >= MAX_EXP) {
         return pow_hierarchical(base, exp);
     }
     static std::vector<std::vector<std::optional<BaseType>>> cache;
@@ -185,7 +731,7 @@ inline BaseType pow_cached_vector_optional(BaseType base, ExpType exp) requires
 // Static array cache for small integer ranges
 template <typename BaseType, typename ExpType, size_t MAX_BASE = 16, size_t MAX_EXP = 16>
 inline BaseType pow_cached_static_array(BaseType base, ExpType exp) requires IsIntegralUnsigned<BaseType, ExpType> {
-    if (base >= 0 && static_cast<size_t>(base) < MAX_BASE && exp < MAX_EXP) {
+    if (!is_negative(base) && static_cast<size_t>(base) < MAX_BASE && exp < MAX_EXP) {
         static BaseType cache[MAX_BASE][MAX_EXP] = {};
         static bool is_cached[MAX_BASE][MAX_EXP] = {};
 
@@ -212,6 +758,15 @@ inline auto pow_c_raw(BaseType base, ExpType exp) requires IsArithmeticFloating<
     }
 }
 
+// Contract of the libm pow/powf behind pow_c_raw and std::pow. Under
+// -ffast-math GCC rewrites pow with a constant exponent into sqrt/cbrt
+// chains and reciprocals, which round several times.
+#ifdef __FAST_MATH__
+inline constexpr double kLibmPowUlpBound = 4.0;
+#else
+inline constexpr double kLibmPowUlpBound = 1.0;
+#endif
+
 // Cube root functions
 template <typename BaseType>
 inline double cbrt_wrapper(BaseType x) requires IsArithmetic<BaseType> {
@@ -225,6 +780,12 @@ inline double pow_2_3_cbrt(BaseType x) requires IsArithmetic<BaseType> {
     return cbrt(x_squared);
 }
 
+// Contract: cbrt is within 4 ULP (glibc) and divides the rounding of x*x by
+// three; no bound once x*x overflows or leaves the normal range
+inline double pow_2_3_cbrt_ulp_bound(double x) {
+    return std::isnormal(x * x) ? 9.0 : std::numeric_limits<double>::infinity();
+}
+
 // Exponential and logarithmic functions
 // pow(x, 2/3) = exp(2/3 * log(x))
 template <typename BaseType>
@@ -233,6 +794,13 @@ inline double pow_2_3_exp_log(BaseType base) requires IsArithmetic<BaseType> {
     return ::exp(two_thirds * ::log(static_cast<double>(base)));
 }
 
+// Contract: rounding 2/3, log and the product leave an absolute error of about
+// 3.5 ULP-units times y = 2/3*log(x) in the argument of exp, which exp turns
+// into relative error; exp itself adds up to 1 ULP
+inline double pow_2_3_exp_log_ulp_bound(double x) {
+    return 2.0 + 3.5 * (2.0 / 3.0) * std::fabs(std::log(x));
+}
+
 // Binomial series expansion for pow(x, 2/3)
 template <typename BaseType>
 inline double pow_2_3_series(BaseType base) requires IsArithmetic<BaseType> {
@@ -265,4 +833,385 @@ inline double pow_2_3_series(BaseType base) requires IsArithmetic<BaseType> {
     return n_squared * sum;
 }
 
-} // namespace powerix 
\ No newline at end of file
+// No contract: with n = round(cbrt(x)) the series runs on z = x/n^3 - 1, which
+// leaves the convergence disk for x in [2, 3.375) and converges slowly near it
+inline double pow_2_3_series_ulp_bound(double) {
+    return std::numeric_limits<double>::infinity();
+}
+
+// Polynomial pow(x, P/Q) for float and double, branch-free so batch loops vectorize.
+// x = 2^e * m with m in [sqrt(1/2), sqrt(2)), and P*e = Q*k + j with 0 <= j < Q, so
+//   x^(P/Q) = 2^k * 2^(j/Q) * exp(P/Q * ln(m))
+// where 2^k is exact, 2^(j/Q) is a compile-time constant and both series below
+// run on small arguments:
+//   ln(m)  = 2*atanh(s) = 2*(s + s^3/3 + s^5/5 + ...),  s = (m-1)/(m+1), |s| < 0.172
+//   exp(a) = 1 + a + a^2/2! + ...,                      |a| < 0.347*P/Q
+// The number of terms of each series is chosen at compile time so that the
+// truncation error fits the MaxUlp target on top of the rounding error.
+namespace detail {
+
+template <typename T>
+struct FloatBits;
+
+template <>
+struct FloatBits<float> {
+    using Bits = uint32_t;
+};
+
+template <>
+struct FloatBits<double> {
+    using Bits = uint64_t;
+};
+
+// exp(x) in long double for compile-time constants
+constexpr long double constexpr_exp(long double x) {
+    long double sum = 1.0L;
+    long double term = 1.0L;
+    for (int k = 1; k < 64; ++k) {
+        term *= x / k;
+        sum += term;
+    }
+    return sum;
+}
+
+inline constexpr long double kLn2 = 0.693147180559945309417232121458176568L;
+inline constexpr long double kLnSqrt2 = kLn2 / 2;
+
+// Rounding error of the reduction and reconstruction, in ULP: about 2, plus
+// the rounding of ln(m) amplified by exponents larger than 1 (measured)
+template <int P, int Q>
+constexpr double poly_rounding_ulp() {
+    constexpr double alpha = static_cast<double>(P < 0 ? -P : P) / Q;
+    return alpha > 1.0 ? 2.0 + 1.5 * (alpha - 1.0) : 2.0;
+}
+
+// Default ULP target: rounding plus two ULP of truncation
+template <int P, int Q>
+inline constexpr unsigned kDefaultPolyUlp = static_cast<unsigned>(poly_rounding_ulp<P, Q>() + 0.999) + 2;
+
+template <typename T, unsigned MaxUlp, int P, int Q>
+constexpr double poly_truncation_budget() {
+    static_assert(MaxUlp > poly_rounding_ulp<P, Q>(), "MaxUlp must leave room for the rounding error");
+    // Relative error r is at most 2r/epsilon ULP; half the budget per series
+    return (MaxUlp - poly_rounding_ulp<P, Q>()) * static_cast<double>(std::numeric_limits<T>::epsilon()) / 4;
+}
+
+// Terms of the atanh series so that the relative error of ln(m), scaled by the
+// exponent P/Q, stays within budget
+template <typename T, unsigned MaxUlp, int P, int Q>
+constexpr int log_series_terms() {
+    constexpr double s_max = 0.17157287525380990; // (sqrt2 - 1) / (sqrt2 + 1)
+    constexpr double scale = kLnSqrt2 * (P < 0 ? -P : P) / Q;
+    int terms = 1;
+    double s_pow = s_max * s_max;
+    while (scale * s_pow / (2 * terms + 1) / (1 - s_max * s_max) > poly_truncation_budget<T, MaxUlp, P, Q>()) {
+        s_pow *= s_max * s_max;
+        ++terms;
+    }
+    return terms;
+}
+
+// Exponents with |P/Q| > 1 reduce the exp argument by a multiple of ln2
+template <int P, int Q>
+inline constexpr bool kReduceExpArgument = (P < 0 ? -P : P) > Q;
+
+// Degree of the exp Taylor polynomial for |a| <= ln(sqrt2) * min(|P/Q|, 1)
+template <typename T, unsigned MaxUlp, int P, int Q>
+constexpr int exp_series_degree() {
+    constexpr double a_max = kReduceExpArgument<P, Q> ? static_cast<double>(kLnSqrt2)
+                                                      : static_cast<double>(kLnSqrt2) * (P < 0 ? -P : P) / Q;
+    constexpr double growth = static_cast<double>(constexpr_exp(2 * a_max));
+    int degree = 1;
+    double tail = a_max * a_max / 2;
+    while (tail * growth > poly_truncation_budget<T, MaxUlp, P, Q>()) {
+        ++degree;
+        tail *= a_max / (degree + 1);
+    }
+    return degree;
+}
+
+template <typename T, unsigned MaxUlp, int P, int Q>
+inline T pow_rational_poly(T x) {
+    static_assert(Q > 0, "denominator must be positive");
+    using Bits = typename FloatBits<T>::Bits;
+    constexpr int mant_bits = std::numeric_limits<T>::digits - 1;
+    constexpr int bias = std::numeric_limits<T>::max_exponent - 1;
+    constexpr Bits exp_mask = (Bits{1} << (sizeof(T) * 8 - 1 - mant_bits)) - 1;
+    constexpr Bits mant_mask = (Bits{1} << mant_bits) - 1;
+    // Adding 2^mant_bits moves a small non-negative integer into the low mantissa
+    // bits and back, so no int<->float conversion breaks vectorization
+    constexpr T magic = static_cast<T>(Bits{1} << mant_bits);
+    constexpr T sqrt2 = static_cast<T>(1.41421356237309504880168872420969808L);
+    constexpr T subnormal_scale = static_cast<T>(Bits{1} << (mant_bits + 1));
+    constexpr int log_terms = log_series_terms<T, MaxUlp, P, Q>();
+    constexpr int exp_degree = exp_series_degree<T, MaxUlp, P, Q>();
+
+    // Selects are written as bit masks: with ?: the compiler threads the two
+    // cases into branches, and only AVX-512 masking vectorizes those back
+    const auto select = [](bool cond, T if_true, T if_false) {
+        const Bits mask = Bits{0} - static_cast<Bits>(cond);
+        return std::bit_cast<T>((std::bit_cast<Bits>(if_true) & mask) | (std::bit_cast<Bits>(if_false) & ~mask));
+    };
+
+    // Normalize subnormals
+    const bool subnormal = x < std::numeric_limits<T>::min();
+    const T xn = x * select(subnormal, subnormal_scale, static_cast<T>(1));
+    const Bits bits = std::bit_cast<Bits>(xn);
+
+    // Biased exponent as T, then m in [1, 2) folded into [sqrt(1/2), sqrt(2))
+    T e = std::bit_cast<T>(((bits >> mant_bits) & exp_mask) | std::bit_cast<Bits>(magic)) - magic;
+    e -= select(subnormal, static_cast<T>(bias + mant_bits + 1), static_cast<T>(bias));
+    T m = std::bit_cast<T>((bits & mant_mask) | std::bit_cast<Bits>(static_cast<T>(1)));
+    const bool fold = m > sqrt2;
+    m *= select(fold, static_cast<T>(0.5), static_cast<T>(1));
+    e += select(fold, static_cast<T>(1), static_cast<T>(0));
+
+    // ln(m) via atanh series
+    const T s = (m - static_cast<T>(1)) / (m + static_cast<T>(1));
+    const T s2 = s * s;
+    T log_poly = static_cast<T>(1) / static_cast<T>(2 * log_terms - 1);
+    for (int k = log_terms - 2; k >= 0; --k) {
+        log_poly = log_poly * s2 + static_cast<T>(1) / static_cast<T>(2 * k + 1);
+    }
+    T a = static_cast<T>(2.0L * P / Q) * s * log_poly;
+
+    // Large exponents: a = n*ln2 + r with |r| <= ln(sqrt2), ln2 split in a high
+    // part exact for small n and a low correction (Cody-Waite)
+    T n = static_cast<T>(0);
+    if constexpr (kReduceExpArgument<P, Q>) {
+        constexpr T ln2_hi = static_cast<T>(kLn2);
+        constexpr T ln2_lo = static_cast<T>(kLn2 - static_cast<long double>(ln2_hi));
+        const T y = a * static_cast<T>(1.0L / kLn2);
+        n = static_cast<T>(static_cast<int32_t>(y + select(y < static_cast<T>(0), static_cast<T>(-0.5), static_cast<T>(0.5))));
+        a = (a - n * ln2_hi) - n * ln2_lo;
+    }
+
+    // exp(a) via Taylor polynomial
+    T exp_poly = static_cast<T>(1);
+    for (int k = exp_degree; k >= 1; --k) {
+        exp_poly = exp_poly * a * static_cast<T>(1.0L / k) + static_cast<T>(1);
+    }
+
+    // P*e = Q*k + j; all values are small integers, exact in T. The quotient is
+    // truncated through int32 (which vectorizes, unlike std::floor without
+    // -ffast-math) and corrected down to the floor for negative exponents
+    const T pe = static_cast<T>(P) * e;
+    const T k_trunc = static_cast<T>(static_cast<int32_t>(pe / static_cast<T>(Q)));
+    const T k_floor = k_trunc - select(static_cast<T>(Q) * k_trunc > pe, static_cast<T>(1), static_cast<T>(0));
+    const T j = pe - static_cast<T>(Q) * k_floor;
+    const T k = k_floor + n;
+    // 2^(j/Q) picked with selects rather than a table load, which vectorizes as blends
+    constexpr auto frac_scales = []<int... J>(std::integer_sequence<int, J...>) {
+        return std::array<T, Q>{static_cast<T>(constexpr_exp(kLn2 * J / Q))...};
+    }(std::make_integer_sequence<int, Q>{});
+    T frac_scale = frac_scales[0];
+    for (int jj = 1; jj < Q; ++jj) {
+        frac_scale = select(j == static_cast<T>(jj), frac_scales[jj], frac_scale);
+    }
+
+    const auto two_pow = [](T n) {
+        const Bits biased = std::bit_cast<Bits>(n + static_cast<T>(bias) + magic) & mant_mask;
+        return std::bit_cast<T>(biased << mant_bits);
+    };
+    T result;
+    if constexpr ((P < 0 ? -P : P) * (bias + mant_bits + 1) + Q < Q * (bias - 1)) {
+        // 2^k is always a normal number
+        result = two_pow(k) * (frac_scale * exp_poly);
+    } else {
+        // 2^k may overflow or underflow: clamp to where the result is inf or 0
+        // anyway and apply it as two normal factors, rounding only once
+        constexpr T k_max = static_cast<T>(2 * bias);
+        constexpr T k_min = static_cast<T>(2 * (1 - bias));
+        const T k_clamped = select(k < k_min, k_min, select(k > k_max, k_max, k));
+        const T k_half = static_cast<T>(static_cast<int32_t>(k_clamped * static_cast<T>(0.5)));
+        result = (two_pow(k_half) * (frac_scale * exp_poly)) * two_pow(k_clamped - k_half);
+    }
+
+    // Special values
+    constexpr T at_zero = P > 0 ? static_cast<T>(0) : std::numeric_limits<T>::infinity();
+    constexpr T at_inf = P > 0 ? std::numeric_limits<T>::infinity() : static_cast<T>(0);
+    T out = select(x == static_cast<T>(0), at_zero, result);
+    out = select(x == std::numeric_limits<T>::infinity(), at_inf, out);
+    out = select((x < static_cast<T>(0)) | (x != x), std::numeric_limits<T>::quiet_NaN(), out);
+    return out;
+}
+
+} // namespace detail
+
+// pow(x, 2/3) from polynomial log/exp approximations within MaxUlp ULP
+template <unsigned MaxUlp = 4, typename BaseType>
+inline BaseType pow_2_3_poly(BaseType base) requires std::is_floating_point_v<BaseType> {
+    return detail::pow_rational_poly<BaseType, MaxUlp, 2, 3>(base);
+}
+
+// Contract: the MaxUlp target the polynomials were fitted for
+template <unsigned MaxUlp = 4>
+constexpr double pow_2_3_poly_ulp_bound(double) {
+    return MaxUlp;
+}
+
+// Batched pow(x, 2/3) for float and double arrays
+template <unsigned MaxUlp = 4, typename BaseType>
+inline void pow_2_3_batch(std::span<const BaseType> bases, std::span<BaseType> out) requires std::is_floating_point_v<BaseType> {
+    assert(bases.size() == out.size());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = detail::pow_rational_poly<BaseType, MaxUlp, 2, 3>(bases[i]);
+    }
+}
+
+// Rational exponents: pow(x, P/Q) with P/Q known at compile time
+enum class RationalStrategy {
+    Root,    // sqrt/cbrt/pow(x, 1/Q), then pow_static<|P|> and a reciprocal for P < 0
+    ExpLog,  // exp(P/Q * log(x))
+    Series,  // binomial series around the nearest perfect Q-th power
+    Poly,    // branch-free polynomial kernel, see detail::pow_rational_poly
+};
+
+// Root wins for integer exponents and for sqrt with a small numerator: sqrt is
+// correctly rounded, and x^(3/2) measures 2.7 ULP against Poly's 2.8-3.1. The
+// root's error is multiplied by |P|, so Root falls behind beyond that. Over
+// x in 2^[-20, 20], x^(5/2) measures 5.3 ULP against Poly's 3.7-4.2. With
+// cbrt, x^(2/3) measures 2.6 ULP in float and 8.8 in double (glibc's double
+// cbrt is the weaker one), and x^(4/3) measures 5.9 and 19, against Poly's
+// 2.4-2.7. The polynomial kernel handles everything else.
+template <int P, int Q>
+constexpr RationalStrategy default_rational_strategy() {
+    constexpr int g = std::gcd(P, Q);
+    constexpr int p = P / g;
+    constexpr int q = Q / g;
+    if constexpr (q == 1 || (q == 2 && (p < 0 ? -p : p) <= 3)) {
+        return RationalStrategy::Root;
+    } else {
+        return RationalStrategy::Poly;
+    }
+}
+
+namespace detail {
+
+template <int Q, typename T>
+inline T root_q(T x) {
+    if constexpr (Q == 1) {
+        return x;
+    } else if constexpr (Q == 2) {
+        return std::sqrt(x);
+    } else if constexpr (Q == 3) {
+        return std::cbrt(x);
+    } else {
+        return std::pow(x, static_cast<T>(1) / static_cast<T>(Q));
+    }
+}
+
+// Negative P takes the reciprocal first so x^|P| cannot overflow on the way
+template <int P, typename T>
+inline T pow_signed_static(T x) {
+    if constexpr (P < 0) {
+        return pow_static<static_cast<unsigned>(-P)>(static_cast<T>(1) / x);
+    } else {
+        return pow_static<static_cast<unsigned>(P)>(x);
+    }
+}
+
+template <int P, int Q, RationalStrategy Strategy, typename T>
+inline T pow_rational_impl(T x) {
+    if constexpr (P == 0) {
+        return static_cast<T>(1);
+    } else if constexpr (Strategy == RationalStrategy::Root) {
+        // Even roots of negative numbers are already NaN; odd ones are real
+        // but pow(x, P/Q) follows std::pow and returns NaN for them too
+        if constexpr (Q % 2 == 1 && Q > 1) {
+            if (x < static_cast<T>(0)) return std::numeric_limits<T>::quiet_NaN();
+        }
+        return pow_signed_static<P>(root_q<Q>(x));
+    } else if constexpr (Strategy == RationalStrategy::ExpLog) {
+        constexpr T alpha = static_cast<T>(static_cast<long double>(P) / Q);
+        return std::exp(alpha * std::log(x));
+    } else if constexpr (Strategy == RationalStrategy::Series) {
+        if (x == static_cast<T>(0)) return pow_rational_impl<P, Q, RationalStrategy::Root>(x);
+        if (x < static_cast<T>(0)) return std::numeric_limits<T>::quiet_NaN();
+
+        const T n = std::round(root_q<Q>(x));
+        const T a = pow_static<static_cast<unsigned>(Q)>(n);
+        if (a == static_cast<T>(0)) {
+            return pow_rational_impl<P, Q, RationalStrategy::ExpLog>(x);
+        }
+
+        const T z = x / a - static_cast<T>(1);
+        constexpr T alpha = static_cast<T>(static_cast<long double>(P) / Q);
+        constexpr int num_terms = 10;
+        T sum = static_cast<T>(1);
+        T term = static_cast<T>(1);
+        for (int k = 1; k < num_terms; ++k) {
+            term *= (alpha - static_cast<T>(k) + static_cast<T>(1)) / static_cast<T>(k) * z;
+            sum += term;
+        }
+        return pow_signed_static<P>(n) * sum;
+    } else {
+        return pow_rational_poly<T, kDefaultPolyUlp<P, Q>, P, Q>(x);
+    }
+}
+
+} // namespace detail
+
+// pow(x, P/Q); P/Q is reduced first, so pow_rational<4, 2> is pow_static<2>.
+// Integral bases are computed in double.
+template <int P, int Q, RationalStrategy Strategy = default_rational_strategy<P, Q>(), typename BaseType>
+inline auto pow_rational(BaseType base) requires IsArithmetic<BaseType> {
+    static_assert(Q > 0, "denominator must be positive");
+    using T = std::conditional_t<std::is_floating_point_v<BaseType>, BaseType, double>;
+    constexpr int g = std::gcd(P, Q);
+    return detail::pow_rational_impl<P / g, Q / g, Strategy>(static_cast<T>(base));
+}
+
+// Contract of pow_rational<P, Q, Strategy> at x, in ULP of the result type:
+//  - Root: the root's own error (sqrt 0.5 ULP, glibc cbrt 4 ULP, pow(x, 1/Q)
+//    1 ULP plus the rounding of 1/Q scaled by |log x|/Q) is multiplied by |P|
+//    in pow_static, on top of its own |P| - 1 roundings
+//  - ExpLog: same analysis as pow_2_3_exp_log with y = P/Q*log(x)
+//  - Poly: the kDefaultPolyUlp target
+//  - Series: no bound, see pow_2_3_series_ulp_bound
+template <int P, int Q, RationalStrategy Strategy = default_rational_strategy<P, Q>()>
+constexpr double pow_rational_ulp_bound(double x) {
+    constexpr int g = std::gcd(P, Q);
+    constexpr int p = P / g;
+    constexpr int q = Q / g;
+    constexpr double abs_p = p < 0 ? -p : p;
+    if constexpr (p == 0) {
+        return 0.0;
+    } else if constexpr (Strategy == RationalStrategy::Root) {
+        // Relative error of the root in units of the unit roundoff (2 per ULP)
+        double root_error = 0.0;
+        if constexpr (q == 2) {
+            root_error = 1.0;
+        } else if constexpr (q == 3) {
+            root_error = 8.0;
+        } else if constexpr (q > 3) {
+            root_error = 2.0 + 0.5 * std::fabs(std::log(x)) / q;
+        }
+        // Under -ffast-math, GCC turns float 1/x and 1/sqrt(x) into rcp/rsqrt
+        // estimates refined by one Newton step, measured at up to 4 ULP
+#ifdef __FAST_MATH__
+        constexpr double reciprocal_error = 4.0;
+#else
+        constexpr double reciprocal_error = 1.0;
+#endif
+        const double reciprocal = p < 0 ? abs_p * reciprocal_error : 0.0;
+        return abs_p * root_error + std::max(abs_p - 1.0, 0.0) + reciprocal;
+    } else if constexpr (Strategy == RationalStrategy::ExpLog) {
+        return 2.0 + 3.5 * std::fabs(static_cast<double>(p) / q * std::log(x));
+    } else if constexpr (Strategy == RationalStrategy::Poly) {
+        return detail::kDefaultPolyUlp<p, q>;
+    } else {
+        return std::numeric_limits<double>::infinity();
+    }
+}
+
+// Batched pow(x, P/Q); the Poly strategy vectorizes, Root only with -fno-math-errno
+template <int P, int Q, RationalStrategy Strategy = default_rational_strategy<P, Q>(), typename BaseType>
+inline void pow_rational_batch(std::span<const BaseType> bases, std::span<BaseType> out) requires std::is_floating_point_v<BaseType> {
+    assert(bases.size() == out.size());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = pow_rational<P, Q, Strategy>(bases[i]);
+    }
+}
+
+} // namespace powerix
\ No newline at end of file
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+namespace powerix {
+
+// Modular exponentiation base^exp mod m for 32- and 64-bit moduli.
+// Odd moduli go through Montgomery multiplication: operands are kept as
+// x * 2^w mod m and every product is reduced with two multiplies and a shift
+// instead of a division. Even moduli (no inverse mod 2^w) fall back to
+// pow_mod_naive, the plain % square-and-multiply ladder.
+
+template <typename UInt>
+concept IsModulusType = std::is_same_v<UInt, uint32_t> || std::is_same_v<UInt, uint64_t>;
+
+namespace detail {
+
+// Double-width type holding the product of two residues
+template <typename UInt>
+struct ModWide;
+
+template <>
+struct ModWide<uint32_t> {
+    using type = uint64_t;
+};
+
+template <>
+struct ModWide<uint64_t> {
+    __extension__ typedef unsigned __int128 type;
+};
+
+template <typename UInt>
+using ModWideType = typename ModWide<UInt>::type;
+
+template <typename UInt>
+constexpr UInt mul_mod(UInt a, UInt b, UInt mod) {
+    using Wide = ModWideType<UInt>;
+    return static_cast<UInt>(static_cast<Wide>(a) * b % mod);
+}
+
+} // namespace detail
+
+// Reference ladder: one wide multiply and one % per step
+template <typename UInt, typename ExpType>
+constexpr UInt pow_mod_naive(UInt base, ExpType exp, UInt mod) requires IsModulusType<UInt> && std::is_unsigned_v<ExpType> {
+    assert(mod != 0);
+    UInt result = static_cast<UInt>(1 % mod);
+    base %= mod;
+
+    while (exp > 0) {
+        if (exp & 1u) {
+            result = detail::mul_mod(result, base, mod);
+        }
+        base = detail::mul_mod(base, base, mod);
+        exp >>= 1;
+    }
+
+    return result;
+}
+
+// Montgomery arithmetic for a fixed odd modulus, R = 2^w with w = bits of UInt.
+// Construct once per modulus (it costs one wide %) and reuse it for many powers.
+template <typename UInt>
+    requires IsModulusType<UInt>
+class Montgomery {
+public:
+    using Wide = detail::ModWideType<UInt>;
+    static constexpr unsigned kBits = std::numeric_limits<UInt>::digits;
+
+    constexpr explicit Montgomery(UInt mod) : mod_(mod) {
+        assert(mod & 1u);
+        // Newton iteration for mod^-1 mod 2^w: an odd mod is its own inverse
+        // mod 8 (3 bits) and each step doubles the number of correct bits
+        UInt inv = mod;
+        for (unsigned bits = 3; bits < kBits; bits *= 2) {
+            inv *= static_cast<UInt>(2) - mod * inv;
+        }
+        inv_ = inv;
+        const UInt r1 = static_cast<UInt>(-mod) % mod;  // 2^w mod m
+        r2_ = detail::mul_mod(r1, r1, mod);               // 2^2w mod m
+        one_ = r1;
+    }
+
+    constexpr UInt modulus() const { return mod_; }
+
+    // t * 2^-w mod m for t < m * 2^w; the low halves of t and q * m cancel
+    constexpr UInt reduce(Wide t) const {
+        const UInt q = static_cast<UInt>(t) * inv_;
+        const UInt hi_t = static_cast<UInt>(t >> kBits);
+        const UInt hi_qm = static_cast<UInt>((static_cast<Wide>(q) * mod_) >> kBits);
+        const UInt r = hi_t - hi_qm;
+        return hi_t < hi_qm ? r + mod_ : r;
+    }
+
+    constexpr UInt to_montgomery(UInt x) const {
+        return reduce(static_cast<Wide>(x % mod_) * r2_);
+    }
+
+    constexpr UInt from_montgomery(UInt x) const {
+        return reduce(static_cast<Wide>(x));
+    }
+
+    constexpr UInt mul(UInt a, UInt b) const {
+        return reduce(static_cast<Wide>(a) * b);
+    }
+
+    // base^exp mod m, with base and result in the normal (non-Montgomery) domain
+    template <typename ExpType>
+    constexpr UInt pow(UInt base, ExpType exp) const requires std::is_unsigned_v<ExpType> {
+        UInt result = one_;
+        UInt current = to_montgomery(base);
+
+        while (exp > 0) {
+            if (exp & 1u) {
+                result = mul(result, current);
+            }
+            current = mul(current, current);
+            exp >>= 1;
+        }
+
+        return from_montgomery(result);
+    }
+
+private:
+    UInt mod_;
+    UInt inv_ = 0;
+    UInt r2_ = 0;
+    UInt one_ = 0;
+};
+
+template <typename UInt, typename ExpType>
+constexpr UInt pow_mod(UInt base, ExpType exp, UInt mod) requires IsModulusType<UInt> && std::is_unsigned_v<ExpType> {
+    assert(mod != 0);
+    if (mod == 1) return 0;
+    if ((mod & 1u) == 0) {
+        return pow_mod_naive(base, exp, mod);
+    }
+    return Montgomery<UInt>(mod).pow(base, exp);
+}
+
+// Batched variants for a fixed modulus: the Montgomery constants are set up once
+template <typename UInt, typename ExpType>
+inline void pow_mod_batch(std::span<const UInt> bases, std::span<const ExpType> exps, UInt mod, std::span<UInt> out) requires IsModulusType<UInt> && std::is_unsigned_v<ExpType> {
+    assert(bases.size() == out.size() && exps.size() == out.size());
+    assert(mod != 0);
+    if (mod == 1 || (mod & 1u) == 0) {
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            out[i] = pow_mod_naive(bases[i], exps[i], mod);
+        }
+        return;
+    }
+
+    const Montgomery<UInt> mont(mod);
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = mont.pow(bases[i], exps[i]);
+    }
+}
+
+template <typename UInt, typename ExpType>
+inline void pow_mod_batch(std::span<const UInt> bases, ExpType exp, UInt mod, std::span<UInt> out) requires IsModulusType<UInt> && std::is_unsigned_v<ExpType> {
+    assert(bases.size() == out.size());
+    assert(mod != 0);
+    if (mod == 1 || (mod & 1u) == 0) {
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            out[i] = pow_mod_naive(bases[i], exp, mod);
+        }
+        return;
+    }
+
+    const Montgomery<UInt> mont(mod);
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = mont.pow(bases[i], exp);
+    }
+}
+
+} // namespace powerix
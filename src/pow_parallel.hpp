@@ -0,0 +1,331 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "pow_impl.hpp"
+#include "pow_dispatch.hpp"
+
+namespace powerix {
+
+// Multi-threaded batch pow over large spans.
+// The input is cut into chunks sized to stay in a core's L2, and the chunks
+// are run on a ThreadPool with work stealing: every participant starts on an
+// even, contiguous share of the chunks, takes work from the front of its own
+// share, and when it runs dry takes the back half of another participant's
+// remaining share. Each chunk runs the single-threaded batch kernel, so the
+// SIMD kernels stay in play inside every thread.
+//
+// std::execution::par_unseq is not used: libstdc++ only parallelizes it with
+// TBB, and its chunking does not know about cache sizes.
+
+// Bytes of input plus output per chunk: half of a typical 1 MiB per-core L2
+inline constexpr std::size_t kParallelChunkBytes = 512 * 1024;
+
+// Elements per chunk for a given footprint per element, a multiple of 64 so
+// chunk boundaries stay cache-line and SIMD aligned
+constexpr std::size_t parallel_chunk_elements(std::size_t bytes_per_element) {
+    const std::size_t elements = kParallelChunkBytes / bytes_per_element;
+    return std::max<std::size_t>(64, elements / 64 * 64);
+}
+
+// Fixed set of worker threads plus the calling thread. parallel_for is not
+// reentrant: a task must not call back into the pool it runs on, and calls
+// from several threads are serialized. Tasks must not throw.
+class ThreadPool {
+public:
+    // threads counts the caller. pin binds participant t to the t-th CPU of the
+    // process affinity mask, wrapping around when the mask has fewer CPUs than
+    // the pool has threads (Linux only). That keeps first-touch placement
+    // stable on NUMA machines. Workers are bound here; the calling thread is
+    // bound for the duration of each parallel_for and gets its own mask back
+    // afterwards. pinned() reports whether every binding took effect.
+    explicit ThreadPool(unsigned threads = std::max(1u, std::thread::hardware_concurrency()), bool pin = false)
+        : ranges_(std::make_unique<Range[]>(std::max(1u, threads))) {
+#if defined(__linux__)
+        if (pin) {
+            cpu_set_t allowed;
+            CPU_ZERO(&allowed);
+            if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+                for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                    if (CPU_ISSET(cpu, &allowed)) cpus_.push_back(cpu);
+                }
+            }
+            pinned_ = !cpus_.empty();
+        }
+#else
+        (void)pin;
+#endif
+        for (unsigned i = 0; i + 1 < std::max(1u, threads); ++i) {
+            workers_.emplace_back([this, i] { worker_loop(i); });
+#if defined(__linux__)
+            if (!cpus_.empty() && !bind(workers_.back().native_handle(), i)) {
+                pinned_ = false;
+            }
+#endif
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned size() const {
+        return static_cast<unsigned>(workers_.size()) + 1;
+    }
+
+    // False when pinning was not requested, is unsupported, or any binding
+    // (including the caller's in a past parallel_for) failed
+    bool pinned() const {
+        return pinned_.load(std::memory_order_relaxed);
+    }
+
+    // Runs fn(chunk) for every chunk in [0, chunks) and returns once all are done.
+    // Participant t starts on chunks [chunks * t / size(), chunks * (t + 1) / size()),
+    // the caller being the last participant.
+    template <typename Fn>
+    void parallel_for(std::size_t chunks, Fn&& fn) {
+        if (chunks == 0) return;
+        std::lock_guard run_lock(run_mutex_);
+#if defined(__linux__)
+        const CallerBinding caller(*this);
+#endif
+        const unsigned n = size();
+        if (n == 1 || chunks == 1) {
+            for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+                fn(chunk);
+            }
+            return;
+        }
+
+        for (unsigned t = 0; t < n; ++t) {
+            std::lock_guard lock(ranges_[t].mutex);
+            ranges_[t].begin = chunks * t / n;
+            ranges_[t].end = chunks * (t + 1) / n;
+        }
+        context_ = &fn;
+        invoke_ = [](void* context, std::size_t chunk) {
+            (*static_cast<std::remove_reference_t<Fn>*>(context))(chunk);
+        };
+        {
+            std::lock_guard lock(mutex_);
+            active_ = n - 1;
+            ++generation_;
+        }
+        wake_.notify_all();
+
+        run(n - 1);
+
+        std::unique_lock lock(mutex_);
+        done_.wait(lock, [this] { return active_ == 0; });
+    }
+
+private:
+#if defined(__linux__)
+    // Binds thread to the CPU of participant t
+    bool bind(pthread_t thread, unsigned t) const {
+        cpu_set_t cpu;
+        CPU_ZERO(&cpu);
+        CPU_SET(cpus_[t % cpus_.size()], &cpu);
+        return pthread_setaffinity_np(thread, sizeof(cpu), &cpu) == 0;
+    }
+
+    // Binds the calling thread as the last participant for one parallel_for
+    // and restores its previous mask afterwards
+    class CallerBinding {
+    public:
+        explicit CallerBinding(ThreadPool& pool) {
+            if (pool.cpus_.empty()) return;
+            bound_ = pthread_getaffinity_np(pthread_self(), sizeof(saved_), &saved_) == 0 &&
+                     pool.bind(pthread_self(), pool.size() - 1);
+            if (!bound_) pool.pinned_.store(false, std::memory_order_relaxed);
+        }
+
+        ~CallerBinding() {
+            if (bound_) pthread_setaffinity_np(pthread_self(), sizeof(saved_), &saved_);
+        }
+
+        CallerBinding(const CallerBinding&) = delete;
+        CallerBinding& operator=(const CallerBinding&) = delete;
+
+    private:
+        cpu_set_t saved_;
+        bool bound_ = false;
+    };
+#endif
+
+    struct alignas(64) Range {
+        std::mutex mutex;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+    };
+
+    bool pop(unsigned self, std::size_t& chunk) {
+        Range& own = ranges_[self];
+        std::lock_guard lock(own.mutex);
+        if (own.begin == own.end) return false;
+        chunk = own.begin++;
+        return true;
+    }
+
+    // Takes the back half of the first victim with at least two chunks left;
+    // a victim's last chunk is always left to its owner
+    bool steal(unsigned self, std::size_t& chunk) {
+        const unsigned n = size();
+        for (unsigned k = 1; k < n; ++k) {
+            Range& victim = ranges_[(self + k) % n];
+            std::size_t begin;
+            std::size_t end;
+            {
+                std::lock_guard lock(victim.mutex);
+                const std::size_t left = victim.end - victim.begin;
+                if (left < 2) continue;
+                begin = victim.end - left / 2;
+                end = victim.end;
+                victim.end = begin;
+            }
+            std::lock_guard lock(ranges_[self].mutex);
+            ranges_[self].begin = begin + 1;
+            ranges_[self].end = end;
+            chunk = begin;
+            return true;
+        }
+        return false;
+    }
+
+    void run(unsigned self) {
+        std::size_t chunk;
+        while (pop(self, chunk) || steal(self, chunk)) {
+            invoke_(context_, chunk);
+        }
+    }
+
+    void worker_loop(unsigned self) {
+        uint64_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock lock(mutex_);
+                wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_) return;
+                seen = generation_;
+            }
+            run(self);
+            {
+                std::lock_guard lock(mutex_);
+                if (--active_ == 0) {
+                    done_.notify_one();
+                }
+            }
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::unique_ptr<Range[]> ranges_;
+    std::vector<int> cpus_;  // CPUs participants are bound to, empty when not pinning
+    std::atomic<bool> pinned_ = false;
+    std::mutex run_mutex_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    uint64_t generation_ = 0;
+    unsigned active_ = 0;
+    bool stop_ = false;
+    void* context_ = nullptr;
+    void (*invoke_)(void*, std::size_t) = nullptr;
+};
+
+// Process-wide pool with one thread per hardware thread, created on first use
+inline ThreadPool& default_thread_pool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+// Array of n elements whose pages are first written by the pool: participant
+// t zeroes the t-th even share, the same share parallel_for hands it first,
+// so on NUMA machines each page lands on the node of the thread that will
+// mostly process it (pin the pool's threads for this to hold)
+template <typename T>
+    requires std::is_trivially_default_constructible_v<T>
+std::unique_ptr<T[]> make_first_touch_array(std::size_t n, ThreadPool& pool = default_thread_pool()) {
+    auto data = std::make_unique_for_overwrite<T[]>(n);
+    const std::size_t shares = pool.size();
+    pool.parallel_for(shares, [&](std::size_t t) {
+        std::fill(data.get() + n * t / shares, data.get() + n * (t + 1) / shares, T{});
+    });
+    return data;
+}
+
+// out[i] = batch(in[i]) over L2-sized chunks; batch is any single-threaded
+// batch kernel taking (std::span<const In>, std::span<Out>), e.g. pow_2_3_batch
+template <typename In, typename Out, typename BatchFn>
+inline void parallel_batch(std::span<const In> in, std::span<Out> out, BatchFn&& batch, ThreadPool& pool = default_thread_pool()) {
+    assert(in.size() == out.size());
+    const std::size_t chunk = parallel_chunk_elements(sizeof(In) + sizeof(Out));
+    pool.parallel_for((out.size() + chunk - 1) / chunk, [&](std::size_t c) {
+        const std::size_t begin = c * chunk;
+        const std::size_t count = std::min(chunk, out.size() - begin);
+        batch(in.subspan(begin, count), out.subspan(begin, count));
+    });
+}
+
+// Parallel pow_binary_batch: every type pair returns pow_binary_batch's bits.
+// double^uint32 goes through the runtime dispatched SIMD kernel inside each
+// chunk, which runs the same ladder
+template <typename BaseType, typename ExpType, typename OutType>
+inline void parallel_pow(std::span<const BaseType> bases, std::span<const ExpType> exps, std::span<OutType> out,
+                         ThreadPool& pool = default_thread_pool()) requires IsArithmeticUnsigned<BaseType, ExpType> {
+    assert(bases.size() == out.size() && exps.size() == out.size());
+    const std::size_t chunk = parallel_chunk_elements(sizeof(BaseType) + sizeof(ExpType) + sizeof(OutType));
+    pool.parallel_for((out.size() + chunk - 1) / chunk, [&](std::size_t c) {
+        const std::size_t begin = c * chunk;
+        const std::size_t count = std::min(chunk, out.size() - begin);
+        if constexpr (std::is_same_v<BaseType, double> && std::is_same_v<ExpType, uint32_t> && std::is_same_v<OutType, double>) {
+            pow_binary_dispatch(bases.subspan(begin, count), exps.subspan(begin, count), out.subspan(begin, count));
+        } else {
+            pow_binary_batch(bases.subspan(begin, count), exps.subspan(begin, count), out.subspan(begin, count));
+        }
+    });
+}
+
+template <typename BaseType, typename ExpType, typename OutType>
+inline void parallel_pow(std::span<const BaseType> bases, ExpType exp, std::span<OutType> out,
+                         ThreadPool& pool = default_thread_pool()) requires IsArithmeticUnsigned<BaseType, ExpType> {
+    assert(bases.size() == out.size());
+    const std::size_t chunk = parallel_chunk_elements(sizeof(BaseType) + sizeof(OutType));
+    pool.parallel_for((out.size() + chunk - 1) / chunk, [&](std::size_t c) {
+        const std::size_t begin = c * chunk;
+        const std::size_t count = std::min(chunk, out.size() - begin);
+        if constexpr (std::is_same_v<BaseType, double> && std::is_same_v<ExpType, uint32_t> && std::is_same_v<OutType, double>) {
+            pow_binary_dispatch(bases.subspan(begin, count), exp, out.subspan(begin, count));
+        } else {
+            pow_binary_batch(bases.subspan(begin, count), exp, out.subspan(begin, count));
+        }
+    });
+}
+
+} // namespace powerix
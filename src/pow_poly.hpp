@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace powerix {
+
+// Polynomial evaluation p(x) = c[0] + c[1] x + ... + c[N-1] x^(N-1), with the
+// number of coefficients N (degree N - 1) fixed at compile time by the array.
+// Summing c[k] * pow(x, k) runs a ladder per term; both schemes here use one
+// fused multiply-add per coefficient or close to it:
+//  - Horner: ((c[N-1] x + c[N-2]) x + ...) x + c[0], N - 1 FMAs in a single
+//    dependency chain. Fewest operations: the best throughput over arrays,
+//    where independent elements fill the pipeline.
+//  - Estrin: pairs c[2i] + c[2i+1] x, then combines pairs with x^2, x^4, ...
+//    A tree of depth log2(N) with a few extra multiplies: the lowest latency
+//    for a single evaluation, since the FMAs of each level are independent.
+// The batch forms are branch-free loops the compiler vectorizes across inputs.
+
+enum class PolyScheme { Horner, Estrin };
+
+namespace detail {
+
+// std::fma only where the hardware has it (a libcall otherwise); a * b + c is
+// still contracted to an FMA by GCC/Clang in GNU mode
+template <typename T>
+inline T poly_fma(T a, T b, T c) {
+#if defined(FP_FAST_FMA)
+    return std::fma(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+
+template <std::size_t Count, typename T>
+inline T estrin_reduce(const std::array<T, Count>& terms, T x) {
+    if constexpr (Count == 1) {
+        return terms[0];
+    } else {
+        std::array<T, (Count + 1) / 2> next;
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((next[I] = poly_fma(terms[2 * I + 1], x, terms[2 * I])), ...);
+        }(std::make_index_sequence<Count / 2>{});
+        if constexpr (Count % 2 == 1) {
+            next[Count / 2] = terms[Count - 1];
+        }
+        return estrin_reduce(next, x * x);
+    }
+}
+
+} // namespace detail
+
+// The FMA chain is unrolled through a fold rather than a loop, so the batch
+// loops stay straight-line code the vectorizer accepts for any degree
+template <std::size_t N, typename T>
+inline T poly_horner(const std::array<T, N>& coeffs, T x) requires std::is_floating_point_v<T> && (N > 0) {
+    T result = coeffs[N - 1];
+    [&]<std::size_t... K>(std::index_sequence<K...>) {
+        ((result = detail::poly_fma(result, x, coeffs[N - 2 - K])), ...);
+    }(std::make_index_sequence<N - 1>{});
+    return result;
+}
+
+template <std::size_t N, typename T>
+inline T poly_estrin(const std::array<T, N>& coeffs, T x) requires std::is_floating_point_v<T> && (N > 0) {
+    return detail::estrin_reduce(coeffs, x);
+}
+
+template <PolyScheme Scheme = PolyScheme::Horner, std::size_t N, typename T>
+inline T poly_eval(const std::array<T, N>& coeffs, T x) requires std::is_floating_point_v<T> && (N > 0) {
+    if constexpr (Scheme == PolyScheme::Horner) {
+        return poly_horner(coeffs, x);
+    } else {
+        return poly_estrin(coeffs, x);
+    }
+}
+
+// out[i] = p(xs[i])
+template <PolyScheme Scheme = PolyScheme::Horner, std::size_t N, typename T>
+inline void poly_eval_batch(const std::array<T, N>& coeffs, std::span<const T> xs, std::span<T> out) requires std::is_floating_point_v<T> && (N > 0) {
+    assert(xs.size() == out.size());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = poly_eval<Scheme>(coeffs, xs[i]);
+    }
+}
+
+// Contract of poly_eval and poly_eval_batch at x, in ULP of T, for either
+// scheme: each term c[k] x^k goes through at most 2 (N - 1) roundings (Horner:
+// one FMA per step; Estrin: one FMA per level plus the squarings that built
+// its power of x), so the result is within 2 (N - 1) ULP times the condition
+// number sum |c[k] x^k| / |p(x)|, which is 1 when all terms share a sign
+template <std::size_t N, typename T>
+inline double poly_eval_ulp_bound(const std::array<T, N>& coeffs, double x) requires std::is_floating_point_v<T> && (N > 0) {
+    long double sum = 0.0L;
+    long double abs_sum = 0.0L;
+    long double power = 1.0L;
+    for (std::size_t k = 0; k < N; ++k) {
+        const long double term = static_cast<long double>(coeffs[k]) * power;
+        sum += term;
+        abs_sum += std::fabs(term);
+        power *= x;
+    }
+    if (sum == 0.0L) return abs_sum == 0.0L ? 0.0 : std::numeric_limits<double>::infinity();
+    return 2.0 * static_cast<double>(N - 1) * static_cast<double>(abs_sum / std::fabs(sum));
+}
+
+} // namespace powerix
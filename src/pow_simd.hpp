@@ -0,0 +1,251 @@
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "pow_impl.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define POWERIX_HAS_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define POWERIX_HAS_X86_SIMD 0
+#endif
+
+namespace powerix {
+
+// Explicit SIMD kernels for double^uint32 with per-lane exponents.
+// Each lane runs the binary square-and-multiply ladder; lanes whose current
+// exponent bit is 0 keep their result through a blend/masked multiply, and the
+// ladder runs for the bit width of the largest exponent in the vector.
+// Kernels are compiled with target attributes so they exist in every build;
+// only call them on CPUs that support the ISA (see cpu_supports_*).
+// Tails are finished with pow_binary, which uses the same multiply order, so
+// every kernel returns pow_binary's bits (not pow_hierarchical's).
+
+#if POWERIX_HAS_X86_SIMD
+
+inline bool cpu_supports_sse4() {
+    return __builtin_cpu_supports("sse4.2");
+}
+
+inline bool cpu_supports_avx2() {
+    return __builtin_cpu_supports("avx2");
+}
+
+inline bool cpu_supports_avx512() {
+    return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl");
+}
+
+__attribute__((target("sse4.2")))
+inline void pow_binary_sse4(const double* bases, const uint32_t* exps, double* out, std::size_t n) {
+    const __m128i one = _mm_set1_epi64x(1);
+    std::size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        const uint32_t bits = exps[i] | exps[i + 1] | exps[i + 2] | exps[i + 3];
+        const int width = std::bit_width(bits);
+
+        __m128d cur0 = _mm_loadu_pd(bases + i);
+        __m128d cur1 = _mm_loadu_pd(bases + i + 2);
+        __m128i e0 = _mm_cvtepu32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(exps + i)));
+        __m128i e1 = _mm_cvtepu32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(exps + i + 2)));
+        __m128d res0 = _mm_set1_pd(1.0);
+        __m128d res1 = _mm_set1_pd(1.0);
+
+        for (int b = 0; b < width; ++b) {
+            const __m128d odd0 = _mm_castsi128_pd(_mm_cmpeq_epi64(_mm_and_si128(e0, one), one));
+            const __m128d odd1 = _mm_castsi128_pd(_mm_cmpeq_epi64(_mm_and_si128(e1, one), one));
+            res0 = _mm_blendv_pd(res0, _mm_mul_pd(res0, cur0), odd0);
+            res1 = _mm_blendv_pd(res1, _mm_mul_pd(res1, cur1), odd1);
+            cur0 = _mm_mul_pd(cur0, cur0);
+            cur1 = _mm_mul_pd(cur1, cur1);
+            e0 = _mm_srli_epi64(e0, 1);
+            e1 = _mm_srli_epi64(e1, 1);
+        }
+
+        _mm_storeu_pd(out + i, res0);
+        _mm_storeu_pd(out + i + 2, res1);
+    }
+
+    for (; i < n; ++i) {
+        out[i] = pow_binary(bases[i], exps[i]);
+    }
+}
+
+__attribute__((target("sse4.2")))
+inline void pow_binary_sse4(const double* bases, uint32_t exp, double* out, std::size_t n) {
+    std::size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        __m128d cur0 = _mm_loadu_pd(bases + i);
+        __m128d cur1 = _mm_loadu_pd(bases + i + 2);
+        __m128d res0 = _mm_set1_pd(1.0);
+        __m128d res1 = _mm_set1_pd(1.0);
+
+        for (uint32_t e = exp; e > 0; e >>= 1) {
+            if (e & 1u) {
+                res0 = _mm_mul_pd(res0, cur0);
+                res1 = _mm_mul_pd(res1, cur1);
+            }
+            cur0 = _mm_mul_pd(cur0, cur0);
+            cur1 = _mm_mul_pd(cur1, cur1);
+        }
+
+        _mm_storeu_pd(out + i, res0);
+        _mm_storeu_pd(out + i + 2, res1);
+    }
+
+    for (; i < n; ++i) {
+        out[i] = pow_binary(bases[i], exp);
+    }
+}
+
+__attribute__((target("avx2")))
+inline void pow_binary_avx2(const double* bases, const uint32_t* exps, double* out, std::size_t n) {
+    const __m256i one = _mm256_set1_epi64x(1);
+    std::size_t i = 0;
+
+    // Two vectors per iteration so the squaring chains of both overlap
+    for (; i + 8 <= n; i += 8) {
+        const uint32_t bits = exps[i] | exps[i + 1] | exps[i + 2] | exps[i + 3]
+                            | exps[i + 4] | exps[i + 5] | exps[i + 6] | exps[i + 7];
+        const int width = std::bit_width(bits);
+
+        __m256d cur0 = _mm256_loadu_pd(bases + i);
+        __m256d cur1 = _mm256_loadu_pd(bases + i + 4);
+        __m256i e0 = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(exps + i)));
+        __m256i e1 = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(exps + i + 4)));
+        __m256d res0 = _mm256_set1_pd(1.0);
+        __m256d res1 = _mm256_set1_pd(1.0);
+
+        for (int b = 0; b < width; ++b) {
+            const __m256d odd0 = _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(e0, one), one));
+            const __m256d odd1 = _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(e1, one), one));
+            res0 = _mm256_blendv_pd(res0, _mm256_mul_pd(res0, cur0), odd0);
+            res1 = _mm256_blendv_pd(res1, _mm256_mul_pd(res1, cur1), odd1);
+            cur0 = _mm256_mul_pd(cur0, cur0);
+            cur1 = _mm256_mul_pd(cur1, cur1);
+            e0 = _mm256_srli_epi64(e0, 1);
+            e1 = _mm256_srli_epi64(e1, 1);
+        }
+
+        _mm256_storeu_pd(out + i, res0);
+        _mm256_storeu_pd(out + i + 4, res1);
+    }
+
+    for (; i < n; ++i) {
+        out[i] = pow_binary(bases[i], exps[i]);
+    }
+}
+
+__attribute__((target("avx2")))
+inline void pow_binary_avx2(const double* bases, uint32_t exp, double* out, std::size_t n) {
+    std::size_t i = 0;
+
+    // Uniform exponent: the ladder is the same for every lane, no blends needed
+    for (; i + 8 <= n; i += 8) {
+        __m256d cur0 = _mm256_loadu_pd(bases + i);
+        __m256d cur1 = _mm256_loadu_pd(bases + i + 4);
+        __m256d res0 = _mm256_set1_pd(1.0);
+        __m256d res1 = _mm256_set1_pd(1.0);
+
+        for (uint32_t e = exp; e > 0; e >>= 1) {
+            if (e & 1u) {
+                res0 = _mm256_mul_pd(res0, cur0);
+                res1 = _mm256_mul_pd(res1, cur1);
+            }
+            cur0 = _mm256_mul_pd(cur0, cur0);
+            cur1 = _mm256_mul_pd(cur1, cur1);
+        }
+
+        _mm256_storeu_pd(out + i, res0);
+        _mm256_storeu_pd(out + i + 4, res1);
+    }
+
+    for (; i < n; ++i) {
+        out[i] = pow_binary(bases[i], exp);
+    }
+}
+
+__attribute__((target("avx512f,avx512vl")))
+inline void pow_binary_avx512(const double* bases, const uint32_t* exps, double* out, std::size_t n) {
+    const __m512i one = _mm512_set1_epi64(1);
+    std::size_t i = 0;
+
+    for (; i < n; i += 8) {
+        // Masked loads handle the tail without a scalar loop
+        const __mmask8 lanes = (n - i >= 8) ? __mmask8(0xFF) : static_cast<__mmask8>((1u << (n - i)) - 1u);
+        __m512d cur = _mm512_maskz_loadu_pd(lanes, bases + i);
+        // Zero-masked forms throughout: GCC 12 fills the unmasked ones from an
+        // undefined register and warns under -Wmaybe-uninitialized
+        __m512i e = _mm512_maskz_cvtepu32_epi64(lanes, _mm256_maskz_loadu_epi32(lanes, exps + i));
+        __m512d res = _mm512_set1_pd(1.0);
+
+        // Ladder until every lane's exponent is consumed
+        while (_mm512_test_epi64_mask(e, e)) {
+            const __mmask8 odd = _mm512_test_epi64_mask(e, one);
+            res = _mm512_mask_mul_pd(res, odd, res, cur);
+            cur = _mm512_mul_pd(cur, cur);
+            e = _mm512_maskz_srli_epi64(lanes, e, 1);
+        }
+
+        _mm512_mask_storeu_pd(out + i, lanes, res);
+    }
+}
+
+__attribute__((target("avx512f,avx512vl")))
+inline void pow_binary_avx512(const double* bases, uint32_t exp, double* out, std::size_t n) {
+    std::size_t i = 0;
+
+    for (; i < n; i += 8) {
+        const __mmask8 lanes = (n - i >= 8) ? __mmask8(0xFF) : static_cast<__mmask8>((1u << (n - i)) - 1u);
+        __m512d cur = _mm512_maskz_loadu_pd(lanes, bases + i);
+        __m512d res = _mm512_set1_pd(1.0);
+
+        for (uint32_t e = exp; e > 0; e >>= 1) {
+            if (e & 1u) {
+                res = _mm512_mul_pd(res, cur);
+            }
+            cur = _mm512_mul_pd(cur, cur);
+        }
+
+        _mm512_mask_storeu_pd(out + i, lanes, res);
+    }
+}
+
+#else
+
+inline bool cpu_supports_sse4() { return false; }
+inline bool cpu_supports_avx2() { return false; }
+inline bool cpu_supports_avx512() { return false; }
+
+#endif // POWERIX_HAS_X86_SIMD
+
+// Best SIMD kernel enabled by the compiler flags of this build
+inline void pow_binary_batch_simd(std::span<const double> bases, std::span<const uint32_t> exps, std::span<double> out) {
+    assert(bases.size() == out.size() && exps.size() == out.size());
+#if defined(__AVX512F__) && defined(__AVX512VL__)
+    pow_binary_avx512(bases.data(), exps.data(), out.data(), out.size());
+#elif defined(__AVX2__)
+    pow_binary_avx2(bases.data(), exps.data(), out.data(), out.size());
+#else
+    pow_binary_batch(bases, exps, out);
+#endif
+}
+
+inline void pow_binary_batch_simd(std::span<const double> bases, uint32_t exp, std::span<double> out) {
+    assert(bases.size() == out.size());
+#if defined(__AVX512F__) && defined(__AVX512VL__)
+    pow_binary_avx512(bases.data(), exp, out.data(), out.size());
+#elif defined(__AVX2__)
+    pow_binary_avx2(bases.data(), exp, out.data(), out.size());
+#else
+    pow_binary_batch(bases, exp, out);
+#endif
+}
+
+} // namespace powerix
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "pow_impl.hpp"
+
+namespace powerix {
+
+namespace detail {
+
+// Integer entries are computed in a wide unsigned type so the constexpr
+// evaluation wraps instead of hitting signed overflow (or uint16 promotion
+// to int); the low bits match what pow_hierarchical returns at runtime.
+template <typename BaseType>
+struct TableWide {
+    using type = BaseType;
+};
+
+template <typename BaseType>
+    requires std::is_integral_v<BaseType>
+struct TableWide<BaseType> {
+    using type = std::make_unsigned_t<std::common_type_t<BaseType, unsigned>>;
+};
+
+template <typename BaseType>
+using TableWideType = typename TableWide<BaseType>::type;
+
+// Same multiply order as pow_hierarchical, so floating entries are bit-identical
+template <typename WideType>
+constexpr WideType table_pow(WideType base, std::size_t exp) {
+    if (exp == 0) return static_cast<WideType>(1);
+    if (exp == 1) return base;
+    const WideType half = table_pow(static_cast<WideType>(base * base), exp >> 1);
+    return (exp & 1) ? static_cast<WideType>(half * base) : half;
+}
+
+} // namespace detail
+
+// Fully precomputed base^exp for base in [0, MaxBase) and exp in [0, MaxExp).
+// The table is built at compile time and stored row-major, one row per base;
+// rows are padded to a whole number of cache lines and the table is 64-byte
+// aligned, so a row never straddles more lines than it needs to. Lookups are a
+// single indexed load with no is_cached flag to test.
+template <typename BaseType, std::size_t MaxBase, std::size_t MaxExp>
+    requires IsArithmetic<BaseType> && (MaxBase > 0) && (MaxExp > 0)
+class PowTable {
+public:
+    static constexpr std::size_t kValuesPerLine = 64 / sizeof(BaseType);
+    static constexpr std::size_t kRowStride = (MaxExp + kValuesPerLine - 1) / kValuesPerLine * kValuesPerLine;
+
+    constexpr PowTable() {
+        using Wide = detail::TableWideType<BaseType>;
+        for (std::size_t b = 0; b < MaxBase; ++b) {
+            for (std::size_t e = 0; e < MaxExp; ++e) {
+                values_[b * kRowStride + e] = static_cast<BaseType>(detail::table_pow(static_cast<Wide>(b), e));
+            }
+        }
+    }
+
+    // Unchecked lookup; base < MaxBase and exp < MaxExp are the caller's contract
+    template <typename ExpType>
+    constexpr BaseType operator()(BaseType base, ExpType exp) const requires std::is_unsigned_v<ExpType> {
+        assert(contains(base, exp));
+        return values_[static_cast<std::size_t>(base) * kRowStride + static_cast<std::size_t>(exp)];
+    }
+
+    // Table lookup inside the range, pow_hierarchical outside it
+    template <typename ExpType>
+    constexpr BaseType get(BaseType base, ExpType exp) const requires std::is_unsigned_v<ExpType> {
+        return contains(base, exp) ? (*this)(base, exp) : pow_hierarchical(base, exp);
+    }
+
+    template <typename ExpType>
+    static constexpr bool contains(BaseType base, ExpType exp) {
+        if constexpr (std::is_integral_v<BaseType>) {
+            return base >= 0 && static_cast<std::size_t>(base) < MaxBase && static_cast<std::size_t>(exp) < MaxExp;
+        } else {
+            // Floating bases only hit the table when they are whole numbers
+            return base >= 0 && base < static_cast<BaseType>(MaxBase)
+                && static_cast<BaseType>(static_cast<std::size_t>(base)) == base
+                && static_cast<std::size_t>(exp) < MaxExp;
+        }
+    }
+
+    // Row for one base: values[e] == base^e for e < MaxExp
+    constexpr const BaseType* row(std::size_t base) const {
+        assert(base < MaxBase);
+        return values_ + base * kRowStride;
+    }
+
+private:
+    alignas(64) BaseType values_[MaxBase * kRowStride] = {};
+};
+
+// One shared instance per configuration, evaluated by the compiler
+template <typename BaseType, std::size_t MaxBase, std::size_t MaxExp>
+inline constexpr PowTable<BaseType, MaxBase, MaxExp> pow_table{};
+
+} // namespace powerix
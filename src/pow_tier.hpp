@@ -0,0 +1,268 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "pow_impl.hpp"
+#include "pow_approx.hpp"
+
+namespace powerix {
+
+// Accuracy tiers: the caller states how accurate x^y must be, and the front end
+// routes to the first kernel, in a fixed order, whose guaranteed bound fits
+// the tier on this build. Call sites name a tier instead of a kernel, so
+// kernels can change underneath them. Budgets, in ULP of the result type:
+//  - Exact: 1 ULP (faithfully rounded)
+//  - Balanced: 4 ULP
+//  - Fast: a relative error of kFastRelError
+// Candidates in order of preference, which is their vectorized throughput at
+// -O3; it is not the speed order at every optimization level (at -O2, where
+// nothing vectorizes, the float x^(2/3) Exact pick, libm-wide, outruns both
+// Fast and Balanced). One is taken only if its worst case over all zero and
+// positive normal inputs fits, so kernels whose bound grows with |log x|
+// (cbrt, exp/log, libm with a rounded exponent) are never picked:
+//  - Root: sqrt and multiply chains, pow_rational's Root strategy for Q <= 2
+//  - Approx: pow_approx at the smallest Refine that fits
+//  - Poly: the polynomial kernel behind pow_2_3_poly and pow_rational
+//  - Libm: pow/powf, for P/Q with a power-of-two Q (exact in T)
+//  - LibmWide: pow in the next wider type, rounded once
+// Fast's bound covers every normal result except those within the bound of
+// overflow, which pow_approx may round to inf (and, with flush-to-zero, those
+// within it of the smallest normal number, which may come back as 0).
+// The pick depends on the build: under -ffast-math kLibmPowUlpBound is 4 and
+// Exact moves from Libm to LibmWide, and where long double is no wider than
+// double no kernel meets Exact for double. pow_tier_choice reports the pick.
+
+enum class Accuracy { Fast, Balanced, Exact };
+
+inline constexpr double kFastRelError = 1e-3;
+
+template <Accuracy Tier, typename T>
+constexpr double accuracy_ulp_budget() requires IsApproxFloat<T> {
+    if constexpr (Tier == Accuracy::Exact) {
+        return 1.0;
+    } else if constexpr (Tier == Accuracy::Balanced) {
+        return 4.0;
+    } else {
+        // Relative error r is at most 2r/epsilon ULP
+        return 2 * kFastRelError / std::numeric_limits<T>::epsilon();
+    }
+}
+
+enum class TierKernel { Root, Approx, Poly, Libm, LibmWide, None };
+
+struct TierChoice {
+    TierKernel kernel = TierKernel::None;
+    int refine = 0;        // Refine of pow_approx
+    unsigned poly_ulp = 0; // MaxUlp target of the Poly kernel
+    double max_ulp = std::numeric_limits<double>::infinity(); // guaranteed bound, ULP of T
+};
+
+constexpr const char* tier_kernel_name(TierKernel kernel) {
+    switch (kernel) {
+        case TierKernel::Root: return "root";
+        case TierKernel::Approx: return "approx";
+        case TierKernel::Poly: return "poly";
+        case TierKernel::Libm: return "libm";
+        case TierKernel::LibmWide: return "libm-wide";
+        case TierKernel::None: return "none";
+    }
+    return "?";
+}
+
+namespace detail {
+
+// Next wider type: double for float, long double for double (x87 extended on
+// x86, but only double on MSVC and AArch64 macOS)
+template <typename T>
+using WideFloat = std::conditional_t<std::is_same_v<T, float>, double, long double>;
+
+template <typename T>
+inline constexpr bool kHasWideFloat = std::numeric_limits<WideFloat<T>>::digits > std::numeric_limits<T>::digits;
+
+// Relative error of x^y from rounding y to U: |delta * ln x| = |ln result| * epsilon / 2,
+// and |ln result| < max_exponent * ln2 for a normal result
+template <typename T, typename U>
+constexpr double exponent_rounding_rel_error() {
+    return std::numeric_limits<T>::max_exponent * static_cast<double>(kLn2) * std::numeric_limits<U>::epsilon() / 2;
+}
+
+// LibmWide in ULP of T: the final rounding, the wide libm error and, for an
+// exponent that is not exact in the wide type, its rounding
+template <typename T>
+constexpr double wide_pow_ulp_bound(bool exact_exponent) {
+    using W = WideFloat<T>;
+    const double rel = kLibmPowUlpBound * std::numeric_limits<W>::epsilon()
+                     + (exact_exponent ? 0.0 : exponent_rounding_rel_error<T, W>());
+    return 0.5 + 2 * rel / std::numeric_limits<T>::epsilon();
+}
+
+// Largest |y| for which pow_approx<Refine> stays within rel_error, -1 if none
+template <typename T, int Refine>
+constexpr double approx_max_exponent(double rel_error) {
+    if (pow_approx_max_rel_error<T, Refine>(0.0) > rel_error) return -1.0;
+    double lo = 0.0;
+    double hi = 1024.0;
+    for (int i = 0; i < 64; ++i) {
+        const double mid = (lo + hi) / 2;
+        (pow_approx_max_rel_error<T, Refine>(mid) <= rel_error ? lo : hi) = mid;
+    }
+    return lo;
+}
+
+template <typename T>
+inline constexpr auto kFastApproxMaxExponent = []<int... R>(std::integer_sequence<int, R...>) {
+    return std::array<double, sizeof...(R)>{approx_max_exponent<T, R>(kFastRelError)...};
+}(std::make_integer_sequence<int, kPowApproxMaxRefine + 1>{});
+
+// Smallest Refine that keeps pow_approx within kFastRelError at exponent y, -1 if none
+template <typename T>
+inline int fast_approx_refine(T y) {
+    const double abs_y = std::fabs(static_cast<double>(y));
+    for (int refine = 0; refine <= kPowApproxMaxRefine; ++refine) {
+        if (abs_y <= kFastApproxMaxExponent<T>[refine]) return refine;
+    }
+    return -1;
+}
+
+} // namespace detail
+
+// Kernel for x^(P/Q) in T at the given tier, and its guaranteed bound
+template <Accuracy Tier, typename T, int P, int Q>
+constexpr TierChoice pow_tier_choice() requires IsApproxFloat<T> {
+    static_assert(Q > 0, "denominator must be positive");
+    constexpr int g = std::gcd(P, Q);
+    constexpr int p = P / g;
+    constexpr int q = Q / g;
+    constexpr double budget = accuracy_ulp_budget<Tier, T>();
+    constexpr double eps = std::numeric_limits<T>::epsilon();
+    constexpr double alpha = static_cast<double>(static_cast<long double>(p) / q);
+
+    if constexpr (q <= 2) {
+        constexpr double bound = pow_rational_ulp_bound<p, q, RationalStrategy::Root>(1.0);
+        if (bound <= budget) return {TierKernel::Root, 0, 0, bound};
+    }
+
+    // pow_approx gets P/Q rounded to T
+    constexpr auto approx_ulp = []<int... R>(std::integer_sequence<int, R...>) {
+        return std::array<double, sizeof...(R)>{
+            2 * (pow_approx_max_rel_error<T, R>(alpha) + detail::exponent_rounding_rel_error<T, T>()) / eps...};
+    }(std::make_integer_sequence<int, kPowApproxMaxRefine + 1>{});
+    for (int refine = 0; refine <= kPowApproxMaxRefine; ++refine) {
+        if (approx_ulp[refine] <= budget) return {TierKernel::Approx, refine, 0, approx_ulp[refine]};
+    }
+
+    constexpr unsigned poly_ulp = budget < detail::kDefaultPolyUlp<p, q> ? static_cast<unsigned>(budget) : detail::kDefaultPolyUlp<p, q>;
+    if (detail::poly_rounding_ulp<p, q>() < poly_ulp) return {TierKernel::Poly, 0, poly_ulp, static_cast<double>(poly_ulp)};
+
+    if ((q & (q - 1)) == 0 && kLibmPowUlpBound <= budget) return {TierKernel::Libm, 0, 0, kLibmPowUlpBound};
+
+    if constexpr (detail::kHasWideFloat<T>) {
+        constexpr double bound = detail::wide_pow_ulp_bound<T>((q & (q - 1)) == 0);
+        if (bound <= budget) return {TierKernel::LibmWide, 0, 0, bound};
+    }
+    return {};
+}
+
+// x^(P/Q) through the kernel pow_tier_choice picks
+template <Accuracy Tier, int P, int Q, typename T>
+inline T pow(T x) requires IsApproxFloat<T> {
+    constexpr TierChoice choice = pow_tier_choice<Tier, T, P, Q>();
+    static_assert(choice.kernel != TierKernel::None, "no kernel meets this accuracy tier for this type on this build");
+    constexpr int g = std::gcd(P, Q);
+    constexpr int p = P / g;
+    constexpr int q = Q / g;
+    constexpr long double alpha = static_cast<long double>(p) / q;
+
+    if constexpr (choice.kernel == TierKernel::Root) {
+        return pow_rational<p, q, RationalStrategy::Root>(x);
+    } else if constexpr (choice.kernel == TierKernel::Approx) {
+        return pow_approx<choice.refine>(x, static_cast<T>(alpha));
+    } else if constexpr (choice.kernel == TierKernel::Poly) {
+        return detail::pow_rational_poly<T, choice.poly_ulp, p, q>(x);
+    } else if constexpr (choice.kernel == TierKernel::Libm) {
+        return std::pow(x, static_cast<T>(alpha));
+    } else {
+        using W = detail::WideFloat<T>;
+        return static_cast<T>(std::pow(static_cast<W>(x), static_cast<W>(alpha)));
+    }
+}
+
+// x^y with y known only at run time: Fast takes pow_approx at the smallest
+// Refine that fits |y| and libm beyond, Balanced libm, and Exact libm or,
+// where libm is not faithful (-ffast-math), libm in the wider type
+template <Accuracy Tier, typename T>
+inline T pow(T x, std::type_identity_t<T> y) requires IsApproxFloat<T> {
+    if constexpr (Tier == Accuracy::Fast) {
+        switch (detail::fast_approx_refine(y)) {
+            case 0: return pow_approx<0>(x, y);
+            case 1: return pow_approx<1>(x, y);
+            case 2: return pow_approx<2>(x, y);
+            case 3: return pow_approx<3>(x, y);
+            default: return std::pow(x, y);
+        }
+    } else if constexpr (kLibmPowUlpBound <= accuracy_ulp_budget<Tier, T>()) {
+        return std::pow(x, y);
+    } else {
+        static_assert(detail::kHasWideFloat<T> && detail::wide_pow_ulp_bound<T>(true) <= accuracy_ulp_budget<Tier, T>(),
+                      "no kernel meets this accuracy tier for this type on this build");
+        using W = detail::WideFloat<T>;
+        return static_cast<T>(std::pow(static_cast<W>(x), static_cast<W>(y)));
+    }
+}
+
+// Guaranteed bound of pow<Tier>(x, y) at exponent y, in ULP of T
+template <Accuracy Tier, typename T>
+inline double pow_tier_ulp_bound(double y) requires IsApproxFloat<T> {
+    if constexpr (Tier == Accuracy::Fast) {
+        const int refine = detail::fast_approx_refine(static_cast<T>(y));
+        constexpr auto approx_ulp = []<int... R>(std::integer_sequence<int, R...>) {
+            return std::array<double (*)(double), sizeof...(R)>{pow_approx_max_rel_error<T, R>...};
+        }(std::make_integer_sequence<int, kPowApproxMaxRefine + 1>{});
+        return refine < 0 ? kLibmPowUlpBound : 2 * approx_ulp[refine](y) / std::numeric_limits<T>::epsilon();
+    } else if constexpr (kLibmPowUlpBound <= accuracy_ulp_budget<Tier, T>()) {
+        return kLibmPowUlpBound;
+    } else {
+        return detail::wide_pow_ulp_bound<T>(true);
+    }
+}
+
+// out[i] = pow<Tier, P, Q>(bases[i]); the Approx and Poly kernels vectorize
+template <Accuracy Tier, int P, int Q, typename T>
+inline void pow_batch(std::span<const T> bases, std::span<T> out) requires IsApproxFloat<T> {
+    assert(bases.size() == out.size());
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        out[i] = pow<Tier, P, Q>(bases[i]);
+    }
+}
+
+// out[i] = pow<Tier>(bases[i], exp), with the kernel chosen once for the array
+template <Accuracy Tier, typename T>
+inline void pow_batch(std::span<const T> bases, std::type_identity_t<T> exp, std::span<T> out) requires IsApproxFloat<T> {
+    assert(bases.size() == out.size());
+    if constexpr (Tier == Accuracy::Fast) {
+        switch (detail::fast_approx_refine(exp)) {
+            case 0: return pow_approx_batch<0>(bases, exp, out);
+            case 1: return pow_approx_batch<1>(bases, exp, out);
+            case 2: return pow_approx_batch<2>(bases, exp, out);
+            case 3: return pow_approx_batch<3>(bases, exp, out);
+            default: break;
+        }
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            out[i] = std::pow(bases[i], exp);
+        }
+    } else {
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            out[i] = pow<Tier>(bases[i], exp);
+        }
+    }
+}
+
+} // namespace powerix
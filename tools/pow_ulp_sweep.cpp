@@ -0,0 +1,252 @@
+// Exhaustive float / stratified double ULP sweep for the 2/3 power kernels.
+//
+// Every one of the 2^32 float bit patterns (or every stride-th one) is fed to
+// each kernel and compared with a reference computed in higher precision; for
+// doubles, a fixed number of random mantissas is drawn in every binade. Work is
+// split in chunks across threads. For each kernel the tool prints the max ULP
+// error with its argument, a histogram of ULP errors, and the number of
+// special-value mismatches (NaN/inf where the reference is finite or vice versa).
+//
+// usage: pow_ulp_sweep [--kernel NAME] [--threads N] [--float-stride S]
+//                      [--double-samples N] [--no-float] [--no-double]
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../src/error_util.hpp"
+#include "../src/pow_impl.hpp"
+
+namespace {
+
+struct Kernel {
+    const char* name;
+    float (*f32)(float);
+    double (*f64)(double);
+};
+
+// Kernels returning double for float inputs are rounded to float: the sweep
+// measures what a float caller gets back
+const Kernel kKernels[] = {
+    {"std_pow",
+     [](float x) { return std::pow(x, 2.0f / 3.0f); },
+     [](double x) { return std::pow(x, 2.0 / 3.0); }},
+    {"exp_log",
+     [](float x) { return static_cast<float>(powerix::pow_2_3_exp_log(x)); },
+     [](double x) { return powerix::pow_2_3_exp_log(x); }},
+    {"cbrt",
+     [](float x) { return static_cast<float>(powerix::pow_2_3_cbrt(x)); },
+     [](double x) { return powerix::pow_2_3_cbrt(x); }},
+    {"series",
+     [](float x) { return static_cast<float>(powerix::pow_2_3_series(x)); },
+     [](double x) { return powerix::pow_2_3_series(x); }},
+    {"poly",
+     [](float x) { return powerix::pow_2_3_poly(x); },
+     [](double x) { return powerix::pow_2_3_poly(x); }},
+};
+
+// x^(2/3) with std::pow semantics (NaN for negative finite x, +inf for -inf). cbrt(x)^2 avoids the
+// rounding of 2/3 itself; one extra level of precision keeps the reference
+// error far below the ULP of the swept type.
+long double reference_f32(float x) {
+    if (std::isinf(x)) return std::numeric_limits<long double>::infinity();
+    if (x < 0) return std::numeric_limits<long double>::quiet_NaN();
+    const double c = std::cbrt(static_cast<double>(x));
+    return static_cast<long double>(c * c);
+}
+
+long double reference_f64(double x) {
+    if (std::isinf(x)) return std::numeric_limits<long double>::infinity();
+    if (x < 0) return std::numeric_limits<long double>::quiet_NaN();
+    const long double c = std::cbrt(static_cast<long double>(x));
+    return c * c;
+}
+
+// Histogram buckets: [0, 0.5], (0.5, 1], (1, 2], (2, 4], ... (2^19, 2^20], > 2^20
+constexpr int kBuckets = 23;
+
+int bucket_of(double ulp) {
+    if (ulp <= 0.5) return 0;
+    if (ulp > 0x1p20) return kBuckets - 1;
+    return 1 + std::max(0, static_cast<int>(std::ceil(std::log2(ulp))));
+}
+
+std::string bucket_label(int b) {
+    char label[32];
+    if (b == 0) std::snprintf(label, sizeof(label), "[0, 0.5]");
+    else if (b == 1) std::snprintf(label, sizeof(label), "(0.5, 1]");
+    else if (b == kBuckets - 1) std::snprintf(label, sizeof(label), "> 2^20");
+    else std::snprintf(label, sizeof(label), "(2^%d, 2^%d]", b - 2, b - 1);
+    return label;
+}
+
+struct SweepResult {
+    double max_ulp = 0.0;
+    double worst_arg = 0.0;
+    double worst_value = 0.0;
+    long double worst_reference = 0.0L;
+    uint64_t special_mismatches = 0;
+    double special_arg = 0.0;
+    uint64_t count = 0;
+    std::array<uint64_t, kBuckets> histogram{};
+
+    template <typename T>
+    void record(T x, T value, long double reference) {
+        ++count;
+        const double ulp = powerix::ulp_error<T>(reference, value);
+        if (std::isinf(ulp)) {
+            if (special_mismatches++ == 0) special_arg = x;
+            return;
+        }
+        ++histogram[bucket_of(ulp)];
+        if (ulp > max_ulp) {
+            max_ulp = ulp;
+            worst_arg = x;
+            worst_value = value;
+            worst_reference = reference;
+        }
+    }
+
+    void merge(const SweepResult& other) {
+        if (other.max_ulp > max_ulp) {
+            max_ulp = other.max_ulp;
+            worst_arg = other.worst_arg;
+            worst_value = other.worst_value;
+            worst_reference = other.worst_reference;
+        }
+        if (special_mismatches == 0 && other.special_mismatches != 0) special_arg = other.special_arg;
+        special_mismatches += other.special_mismatches;
+        count += other.count;
+        for (int b = 0; b < kBuckets; ++b) histogram[b] += other.histogram[b];
+    }
+};
+
+// Runs work(chunk, result) for chunk in [0, chunks) on `threads` threads
+template <typename Work>
+SweepResult run_parallel(uint64_t chunks, unsigned threads, Work work) {
+    std::atomic<uint64_t> next{0};
+    std::vector<SweepResult> partial(threads);
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t] {
+            for (uint64_t chunk = next++; chunk < chunks; chunk = next++) {
+                work(chunk, partial[t]);
+            }
+        });
+    }
+    for (auto& thread : pool) thread.join();
+
+    SweepResult total;
+    for (const auto& p : partial) total.merge(p);
+    return total;
+}
+
+SweepResult sweep_float(const Kernel& kernel, unsigned threads, uint64_t stride) {
+    constexpr uint64_t kPatterns = uint64_t(1) << 32;
+    constexpr uint64_t kChunk = uint64_t(1) << 22;
+    return run_parallel(kPatterns / kChunk, threads, [&](uint64_t chunk, SweepResult& result) {
+        for (uint64_t bits = chunk * kChunk; bits < (chunk + 1) * kChunk; bits += stride) {
+            const float x = std::bit_cast<float>(static_cast<uint32_t>(bits));
+            result.record(x, kernel.f32(x), reference_f32(x));
+        }
+    });
+}
+
+// Every binade of positive doubles (subnormals count as one), samples random
+// mantissas each, plus the negative mirror of every tenth sample
+SweepResult sweep_double(const Kernel& kernel, unsigned threads, uint64_t samples) {
+    constexpr uint64_t kBinades = 2047;  // biased exponents 0 (subnormal) .. 2046
+    return run_parallel(kBinades, threads, [&](uint64_t binade, SweepResult& result) {
+        std::mt19937_64 rng(binade);
+        for (uint64_t i = 0; i < samples; ++i) {
+            const uint64_t mantissa = rng() & ((uint64_t(1) << 52) - 1);
+            const double x = std::bit_cast<double>((binade << 52) | mantissa);
+            result.record(x, kernel.f64(x), reference_f64(x));
+            if (i % 10 == 0) {
+                result.record(-x, kernel.f64(-x), reference_f64(-x));
+            }
+        }
+        if (binade == 0) {
+            for (double x : {0.0, std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()}) {
+                result.record(x, kernel.f64(x), reference_f64(x));
+            }
+        }
+    });
+}
+
+void print_result(const char* kernel, const char* type, const SweepResult& r, double seconds) {
+    std::printf("%s / %s: %llu inputs in %.1f s\n", kernel, type, static_cast<unsigned long long>(r.count), seconds);
+    std::printf("  max ulp      %.3f at x = %a (%.9g): got %a, reference %La\n",
+                r.max_ulp, r.worst_arg, r.worst_arg, r.worst_value, r.worst_reference);
+    std::printf("  special      %llu mismatches", static_cast<unsigned long long>(r.special_mismatches));
+    if (r.special_mismatches != 0) std::printf(" (first at x = %a)", r.special_arg);
+    std::printf("\n");
+    for (int b = 0; b < kBuckets; ++b) {
+        if (r.histogram[b] == 0) continue;
+        std::printf("  %-14s %12llu  %8.4f%%\n", bucket_label(b).c_str(), static_cast<unsigned long long>(r.histogram[b]),
+                    100.0 * static_cast<double>(r.histogram[b]) / static_cast<double>(r.count));
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string only;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    uint64_t float_stride = 1;
+    uint64_t double_samples = uint64_t(1) << 12;
+    bool do_float = true;
+    bool do_double = true;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (!std::strcmp(arg, "--kernel") && has_value) only = argv[++i];
+        else if (!std::strcmp(arg, "--threads") && has_value) threads = std::max(1, std::atoi(argv[++i]));
+        else if (!std::strcmp(arg, "--float-stride") && has_value) float_stride = std::max(1ll, std::atoll(argv[++i]));
+        else if (!std::strcmp(arg, "--double-samples") && has_value) double_samples = std::max(1ll, std::atoll(argv[++i]));
+        else if (!std::strcmp(arg, "--no-float")) do_float = false;
+        else if (!std::strcmp(arg, "--no-double")) do_double = false;
+        else {
+            std::fprintf(stderr, "usage: %s [--kernel NAME] [--threads N] [--float-stride S] [--double-samples N] [--no-float] [--no-double]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    bool found = false;
+    for (const Kernel& kernel : kKernels) {
+        if (!only.empty() && only != kernel.name) continue;
+        found = true;
+
+        if (do_float) {
+            const auto start = std::chrono::steady_clock::now();
+            const SweepResult r = sweep_float(kernel, threads, float_stride);
+            print_result(kernel.name, "float", r, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+        if (do_double) {
+            const auto start = std::chrono::steady_clock::now();
+            const SweepResult r = sweep_double(kernel, threads, double_samples);
+            print_result(kernel.name, "double", r, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+    }
+
+    if (!found) {
+        std::fprintf(stderr, "unknown kernel '%s'; available:", only.c_str());
+        for (const Kernel& kernel : kKernels) std::fprintf(stderr, " %s", kernel.name);
+        std::fprintf(stderr, "\n");
+        return 1;
+    }
+    return 0;
+}